@@ -0,0 +1,112 @@
+/**
+ * @file BurstSampler.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the BurstSampler class.
+ */
+
+#include "BurstSampler.h"
+
+
+// The constructor - needs the buffer and the shape of the burst
+BurstSampler::BurstSampler(int16_t* buffer, uint16_t bufferSize,
+                           uint16_t sampleCount, uint32_t sampleInterval_us,
+                           burstReduction reduction) {
+    _buffer            = buffer;
+    _bufferSize        = bufferSize;
+    _sampleCount       = sampleCount > 0 ? sampleCount : 1;
+    _sampleInterval_us = sampleInterval_us;
+    _reduction         = reduction;
+    _samplesTaken      = 0;
+    _goodSamples       = 0;
+    _nextIndex         = 0;
+    _sum               = 0;
+    _nextSample_us     = 0;
+}
+// Destructor
+BurstSampler::~BurstSampler() {}
+
+
+void BurstSampler::begin(void) {
+    _samplesTaken  = 0;
+    _goodSamples   = 0;
+    _nextIndex     = 0;
+    _sum           = 0;
+    _nextSample_us = micros();
+}
+
+
+// The readings go around the ring, overwriting the oldest once it is full
+void BurstSampler::addSample(int16_t rawCount) {
+    _sum += rawCount;
+    _goodSamples++;
+    if (_bufferSize == 0) return;
+    _buffer[_nextIndex] = rawCount;
+    _nextIndex          = (_nextIndex + 1) % _bufferSize;
+}
+
+
+// Each reading is due a fixed time after the one before it was due, so the
+// rate doesn't drift with the time the readings themselves take
+bool BurstSampler::waitForNextSample(void) {
+    _samplesTaken++;
+    if (_samplesTaken >= _sampleCount) return false;
+    _nextSample_us += _sampleInterval_us;
+    while (static_cast<int32_t>(micros() - _nextSample_us) < 0) {}
+    return true;
+}
+
+
+// Compares two readings for qsort
+static int compareCounts(const void* a, const void* b) {
+    int16_t countA = *static_cast<const int16_t*>(a);
+    int16_t countB = *static_cast<const int16_t*>(b);
+    return (countA > countB) - (countA < countB);
+}
+
+
+float BurstSampler::reduce(void) {
+    if (_goodSamples == 0) return -9999;
+
+    uint16_t kept = _goodSamples < _bufferSize ? _goodSamples : _bufferSize;
+    float    reduced;
+    if (_reduction == BURST_MEAN || kept == 0) {
+        reduced = static_cast<float>(_sum) / _goodSamples;
+    } else {
+        qsort(_buffer, kept, sizeof(int16_t), compareCounts);
+        if (_reduction == BURST_MEDIAN) {
+            uint16_t middle = kept / 2;
+            if (kept % 2 == 1) {
+                reduced = _buffer[middle];
+            } else {
+                reduced = (static_cast<int32_t>(_buffer[middle - 1]) +
+                           _buffer[middle]) /
+                    2.0f;
+            }
+        } else {
+            uint16_t trim =
+                static_cast<uint32_t>(kept) * MS_BURST_TRIM_PERCENT / 100;
+            if (2 * trim >= kept) trim = (kept - 1) / 2;
+            int32_t trimmedSum = 0;
+            for (uint16_t i = trim; i < kept - trim; i++) {
+                trimmedSum += _buffer[i];
+            }
+            reduced = static_cast<float>(trimmedSum) / (kept - 2 * trim);
+        }
+    }
+    MS_DBG(F("Burst of"), _samplesTaken, F("reading[s] with"), _goodSamples,
+           F("good reduced to"), reduced);
+    return reduced;
+}
+
+
+uint16_t BurstSampler::getGoodSampleCount(void) {
+    return _goodSamples;
+}
+
+
+uint32_t BurstSampler::getBurstTime_ms(void) {
+    return (static_cast<uint32_t>(_sampleCount - 1) * _sampleInterval_us) /
+        1000;
+}
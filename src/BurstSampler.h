@@ -0,0 +1,153 @@
+/**
+ * @file BurstSampler.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the BurstSampler class, for taking many fast ADC readings
+ * in a single measurement and reducing them to one value.
+ */
+
+// Header Guards
+#ifndef SRC_BURSTSAMPLER_H_
+#define SRC_BURSTSAMPLER_H_
+
+// Debugging Statement
+// #define MS_BURSTSAMPLER_DEBUG
+
+#ifdef MS_BURSTSAMPLER_DEBUG
+#define MS_DEBUGGING_STD "BurstSampler"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+/**
+ * @brief The percent of the readings dropped from each end of a burst for a
+ * trimmed mean.
+ */
+#ifndef MS_BURST_TRIM_PERCENT
+#define MS_BURST_TRIM_PERCENT 10
+#endif
+
+/**
+ * @brief The ways the readings of a burst can be reduced to one value.
+ */
+typedef enum burstReduction {
+    BURST_MEAN = 0,     ///< The mean of all of the readings
+    BURST_MEDIAN,       ///< The median of the readings kept in the buffer
+    BURST_TRIMMED_MEAN  ///< The mean of the readings kept in the buffer, less
+                        ///< the #MS_BURST_TRIM_PERCENT highest and lowest
+} burstReduction;
+
+/**
+ * @brief Takes a burst of raw ADC readings at a fixed rate into a ring buffer
+ * and reduces them to a single value.
+ *
+ * A burst replaces the single ADC reading of one measurement, so a sensor can
+ * use hundreds of readings per update without going through the full
+ * start/wait/add round trip of the update for each one.  The sensor driver
+ * takes the readings itself:
+ *
+ * @code{cpp}
+ * _burstSampler->begin();
+ * do {
+ *     int16_t reading = ads.readADC_SingleEnded(_adsChannel);
+ *     if (reading < maxCount && reading > minCount) {
+ *         _burstSampler->addSample(reading);
+ *     }
+ * } while (_burstSampler->waitForNextSample());
+ * float reducedCount = _burstSampler->reduce();
+ * @endcode
+ *
+ * The buffer is supplied by the program and is never allocated.  The mean
+ * uses an integer sum of every good reading, so the buffer may be smaller than
+ * the number of readings in a burst when only the mean is wanted.  The median
+ * and trimmed mean use the readings still in the buffer; those are the last
+ * ones taken if the buffer wrapped.
+ *
+ * The whole burst is taken inside one call to the sensor's
+ * addSingleMeasurementResult(), so nothing else runs for the time it takes;
+ * see getBurstTime_ms().
+ */
+class BurstSampler {
+ public:
+    /**
+     * @brief Construct a new BurstSampler object.
+     *
+     * @param buffer An array for the readings; it is not copied, so it must
+     * outlive the sampler.  It can be shared by sensors that are not updated
+     * at the same time.
+     * @param bufferSize The number of readings the array can hold.
+     * @param sampleCount The number of readings to take in each burst.
+     * @param sampleInterval_us The time from the start of one reading to the
+     * start of the next, in microseconds.  Readings that take longer than this
+     * are taken back-to-back.
+     * @param reduction How the readings are reduced to one value; optional
+     * with the default value of BURST_MEAN.
+     */
+    BurstSampler(int16_t* buffer, uint16_t bufferSize, uint16_t sampleCount,
+                 uint32_t       sampleInterval_us,
+                 burstReduction reduction = BURST_MEAN);
+    /**
+     * @brief Destroy the BurstSampler object - no action taken.
+     */
+    ~BurstSampler();
+
+    /**
+     * @brief Forget any earlier burst and mark the time of the first reading.
+     */
+    void begin(void);
+    /**
+     * @brief Add a good reading to the burst.  Bad readings should not be
+     * added at all.
+     *
+     * @param rawCount The reading, in ADC counts.
+     */
+    void addSample(int16_t rawCount);
+    /**
+     * @brief Count a reading as taken and wait until the next one is due.
+     *
+     * @return **bool** True if another reading should be taken; false once
+     * the whole burst has been taken.
+     */
+    bool waitForNextSample(void);
+    /**
+     * @brief Reduce the good readings of the burst to one value.
+     *
+     * The median and trimmed mean sort the buffer in place, so this should
+     * only be called once the burst is finished.
+     *
+     * @return **float** The reduced value, in ADC counts, or -9999 if there
+     * were no good readings.
+     */
+    float reduce(void);
+
+    /**
+     * @brief Get the number of good readings added in the last burst.
+     *
+     * @return **uint16_t** The number of good readings.
+     */
+    uint16_t getGoodSampleCount(void);
+    /**
+     * @brief Get the least time a burst takes, not counting the time of the
+     * last reading.
+     *
+     * @return **uint32_t** The time, in milliseconds.
+     */
+    uint32_t getBurstTime_ms(void);
+
+ private:
+    int16_t*       _buffer;
+    uint16_t       _bufferSize;
+    uint16_t       _sampleCount;
+    uint32_t       _sampleInterval_us;
+    burstReduction _reduction;
+    uint16_t       _samplesTaken;
+    uint16_t       _goodSamples;
+    uint16_t       _nextIndex;
+    int32_t        _sum;
+    uint32_t       _nextSample_us;
+};
+
+#endif  // SRC_BURSTSAMPLER_H_
@@ -64,6 +64,13 @@ Logger::Logger(const char* loggerID, uint16_t loggingIntervalMinutes,
     // Initialize with no file name
     _fileName = "";
 
+    // Write each record straight to a file that grows as needed and close
+    // it, unless told otherwise
+    _keepFileOpen    = false;
+    _sdCardMounted   = false;
+    _sdWriteBuffer   = NULL;
+    _preallocateDays = 0;
+
     // Start with no feature UUID
     _samplingFeatureUUID = NULL;
 
@@ -99,6 +106,13 @@ Logger::Logger(const char* loggerID, uint16_t loggingIntervalMinutes,
     // Initialize with no file name
     _fileName = "";
 
+    // Write each record straight to a file that grows as needed and close
+    // it, unless told otherwise
+    _keepFileOpen    = false;
+    _sdCardMounted   = false;
+    _sdWriteBuffer   = NULL;
+    _preallocateDays = 0;
+
     // Start with no feature UUID
     _samplingFeatureUUID = NULL;
 
@@ -128,6 +142,13 @@ Logger::Logger() {
     // Initialize with no file name
     _fileName = "";
 
+    // Write each record straight to a file that grows as needed and close
+    // it, unless told otherwise
+    _keepFileOpen    = false;
+    _sdCardMounted   = false;
+    _sdWriteBuffer   = NULL;
+    _preallocateDays = 0;
+
     // Start with no feature UUID
     _samplingFeatureUUID = NULL;
 
@@ -168,26 +189,33 @@ void Logger::setSamplingFeatureUUID(const char* samplingFeatureUUID) {
 // Sets up a pin controlling the power to the SD card
 void Logger::setSDCardPwr(int8_t SDCardPowerPin) {
     _SDCardPowerPin = SDCardPowerPin;
+    _SDCardPowerPinHandle.attach(SDCardPowerPin);
     if (_SDCardPowerPin >= 0) {
         pinMode(_SDCardPowerPin, OUTPUT);
-        digitalWrite(_SDCardPowerPin, LOW);
+        _SDCardPowerPinHandle.write(LOW);
     }
 }
 // NOTE:  Structure of power switching on SD card taken from:
 // https://thecavepearlproject.org/2017/05/21/switching-off-sd-cards-for-low-power-data-logging/
 void Logger::turnOnSDcard(bool waitToSettle) {
     if (_SDCardPowerPin >= 0) {
-        digitalWrite(_SDCardPowerPin, HIGH);
+        _SDCardPowerPinHandle.write(HIGH);
         // TODO(SRGDamia1):  figure out how long to wait
         if (waitToSettle) { delay(6); }
     }
 }
 void Logger::turnOffSDcard(bool waitForHousekeeping) {
     if (_SDCardPowerPin >= 0) {
+        // A card that is already off has nothing to write or finish
+        if (!_SDCardPowerPinHandle.read()) return;
+        // Write anything still buffered while the card has power
+        writeBufferedRecords(false);
+        // Neither the open file nor the card's state outlive the power
+        releaseSDCard();
         // TODO(SRGDamia1): set All SPI pins to INPUT?
         // TODO(SRGDamia1): set ALL SPI pins HIGH (~30k pullup)
         pinMode(_SDCardPowerPin, OUTPUT);
-        digitalWrite(_SDCardPowerPin, LOW);
+        _SDCardPowerPinHandle.write(LOW);
         // TODO(SRGDamia1):  wait in lower power mode
         if (waitForHousekeeping) {
             // Specs say up to 1s for internal housekeeping after each write
@@ -210,6 +238,25 @@ void Logger::setSDCardPins(int8_t SDCardSSPin, int8_t SDCardPowerPin) {
     setSDCardSS(SDCardSSPin);
 }
 
+// Sets whether the log file is kept open between records
+void Logger::setKeepFileOpen(bool keepFileOpen) {
+    if (!keepFileOpen) releaseSDCard();
+    _keepFileOpen = keepFileOpen;
+}
+// Sets the RAM buffer records are held in before they go to the SD card
+void Logger::setSDWriteBuffer(SDWriteBuffer* writeBuffer) {
+    // Records already held in an old buffer go out first
+    if (writeBuffer != _sdWriteBuffer) writeBufferedRecords(false);
+    _sdWriteBuffer = writeBuffer;
+}
+bool Logger::flushSDWriteBuffer(void) {
+    return writeBufferedRecords(false);
+}
+// Sets how many days of records new files are pre-allocated for
+void Logger::setFilePreallocation(uint16_t days) {
+    _preallocateDays = days;
+}
+
 
 // Sets up the wake up pin for an RTC interrupt
 void Logger::setRTCWakePin(int8_t mcuWakePin) {
@@ -221,13 +268,14 @@ void Logger::setRTCWakePin(int8_t mcuWakePin) {
 // Sets up a pin for an LED or other way of alerting that data is being logged
 void Logger::setAlertPin(int8_t ledPin) {
     _ledPin = ledPin;
+    _ledPinHandle.attach(ledPin);
     if (_ledPin >= 0) { pinMode(_ledPin, OUTPUT); }
 }
 void Logger::alertOn() {
-    if (_ledPin >= 0) { digitalWrite(_ledPin, HIGH); }
+    if (_ledPin >= 0) { _ledPinHandle.write(HIGH); }
 }
 void Logger::alertOff() {
-    if (_ledPin >= 0) { digitalWrite(_ledPin, LOW); }
+    if (_ledPin >= 0) { _ledPinHandle.write(LOW); }
 }
 
 
@@ -299,11 +347,34 @@ String Logger::getVarCodeAtI(uint8_t position_i) {
 String Logger::getVarUUIDAtI(uint8_t position_i) {
     return _internalArray->arrayOfVars[position_i]->getVarUUID();
 }
+uint8_t Logger::getVarUUIDTextAtI(uint8_t position_i, char* buffer,
+                                  size_t bufferSize) {
+    return _internalArray->arrayOfVars[position_i]->getVarUUIDText(
+        buffer, bufferSize);
+}
+// These print the variable's metadata without making a String of it
+size_t Logger::printVarNameAtI(uint8_t position_i, Print* stream) {
+    return _internalArray->arrayOfVars[position_i]->printVarName(stream);
+}
+size_t Logger::printVarUnitAtI(uint8_t position_i, Print* stream) {
+    return _internalArray->arrayOfVars[position_i]->printVarUnit(stream);
+}
+size_t Logger::printVarCodeAtI(uint8_t position_i, Print* stream) {
+    return _internalArray->arrayOfVars[position_i]->printVarCode(stream);
+}
+size_t Logger::printVarUUIDAtI(uint8_t position_i, Print* stream) {
+    return _internalArray->arrayOfVars[position_i]->printVarUUID(stream);
+}
 // This returns the current value of the variable as a string with the
 // correct number of significant figures
 String Logger::getValueStringAtI(uint8_t position_i) {
     return _internalArray->arrayOfVars[position_i]->getValueString();
 }
+uint8_t Logger::getValueTextAtI(uint8_t position_i, char* buffer,
+                                size_t bufferSize) {
+    return _internalArray->arrayOfVars[position_i]->getValueText(
+        buffer, bufferSize);
+}
 
 
 // ===================================================================== //
@@ -500,30 +571,38 @@ DateTime Logger::dtFromEpoch(uint32_t epochTime) {
     return dt;
 }
 
+// This writes a separator and a two-digit date or time field
+static uint8_t writeDateTimeField(char* text, char separator, uint8_t field) {
+    text[0] = separator;
+    return 1 + ValueFormatter::formatUnsigned(text + 1, 3, field, 2);
+}
+// This writes a date and time as "YYYY-MM-DD hh:mm:ss", with the given
+// character between the date and the time
+static uint8_t writeDateTime(char* buffer, size_t bufferSize, DateTime& dt,
+                             char dateTimeSeparator) {
+    if (bufferSize < 20) {
+        if (bufferSize > 0) buffer[0] = '\0';
+        return 0;
+    }
+    uint8_t length = ValueFormatter::formatUnsigned(buffer, 5, dt.year(), 4);
+    length += writeDateTimeField(buffer + length, '-', dt.month());
+    length += writeDateTimeField(buffer + length, '-', dt.date());
+    length += writeDateTimeField(buffer + length, dateTimeSeparator,
+                                 dt.hour());
+    length += writeDateTimeField(buffer + length, ':', dt.minute());
+    length += writeDateTimeField(buffer + length, ':', dt.second());
+    return length;
+}
+
+
 // This converts a date-time object into a ISO8601 formatted string
 // It assumes the supplied date/time is in the LOGGER's timezone and adds
 // the LOGGER's offset as the time zone offset in the string.
 String Logger::formatDateTime_ISO8601(DateTime& dt) {
-    // Set up an inital string
-    String dateTimeStr;
-    // Convert the DateTime object to a String
-    dt.addToString(dateTimeStr);
-    dateTimeStr.replace(" ", "T");
-    String tzString = String(_loggerTimeZone);
-    if (-24 <= _loggerTimeZone && _loggerTimeZone <= -10) {
-        tzString += F(":00");
-    } else if (-10 < _loggerTimeZone && _loggerTimeZone < 0) {
-        tzString = tzString.substring(0, 1) + '0' + tzString.substring(1, 2) +
-            F(":00");
-    } else if (_loggerTimeZone == 0) {
-        tzString = 'Z';
-    } else if (0 < _loggerTimeZone && _loggerTimeZone < 10) {
-        tzString = "+0" + tzString + F(":00");
-    } else if (10 <= _loggerTimeZone && _loggerTimeZone <= 24) {
-        tzString = "+" + tzString + F(":00");
-    }
-    dateTimeStr += tzString;
-    return dateTimeStr;
+    char dateTimeText[26];
+    formatDateTime_ISO8601(dateTimeText, sizeof(dateTimeText),
+                           dt.get() + EPOCH_TIME_OFF);
+    return String(dateTimeText);
 }
 
 
@@ -531,9 +610,36 @@ String Logger::formatDateTime_ISO8601(DateTime& dt) {
 // It assumes the supplied date/time is in the LOGGER's timezone and adds
 // the LOGGER's offset as the time zone offset in the string.
 String Logger::formatDateTime_ISO8601(uint32_t epochTime) {
+    char dateTimeText[26];
+    formatDateTime_ISO8601(dateTimeText, sizeof(dateTimeText), epochTime);
+    return String(dateTimeText);
+}
+uint8_t Logger::formatDateTime_ISO8601(char* buffer, size_t bufferSize,
+                                       uint32_t epochTime) {
     // Create a DateTime object from the epochTime
-    DateTime dt = dtFromEpoch(epochTime);
-    return formatDateTime_ISO8601(dt);
+    DateTime dt     = dtFromEpoch(epochTime);
+    uint8_t  length = writeDateTime(buffer, bufferSize, dt, 'T');
+    if (length == 0) return 0;
+
+    // The time zone is either "Z" or a signed two-digit hour offset
+    uint8_t zoneLength = _loggerTimeZone == 0 ? 1 : 6;
+    if (length + zoneLength >= bufferSize) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    if (_loggerTimeZone == 0) {
+        buffer[length++] = 'Z';
+        buffer[length]   = '\0';
+        return length;
+    }
+    buffer[length++] = _loggerTimeZone < 0 ? '-' : '+';
+    length += ValueFormatter::formatUnsigned(buffer + length, 3,
+                                             abs(_loggerTimeZone), 2);
+    buffer[length++] = ':';
+    buffer[length++] = '0';
+    buffer[length++] = '0';
+    buffer[length]   = '\0';
+    return length;
 }
 
 
@@ -943,6 +1049,11 @@ void Logger::systemSleep(void) {
 
 // This sets a file name, if you want to decide on it in advance
 void Logger::setFileName(String& fileName) {
+    // The blank end of a pre-allocated file is cut off when the logger moves
+    // on to a new file, since nothing more will be appended to it
+    if (_preallocateDays > 0 && _fileName != "" && fileName != _fileName) {
+        trimLogFile();
+    }
     _fileName = fileName;
 }
 // Same as above, with a character array (overload function)
@@ -982,6 +1093,23 @@ void Logger::generateAutoFileName(void) {
         if (i + 1 != getArrayVarCount()) { stream->print(","); } \
     }                                                            \
     stream->println();
+/**
+ * @brief The same as STREAM_CSV_ROW, for metadata that is printed by a
+ * function taking the position and the stream rather than returned by one.
+ *
+ * THIS IS NOT A FUNCTION, it is a pre-processor macro
+ */
+#define STREAM_CSV_ROW_PRINTED(firstCol, printFunction)          \
+    stream->print("\"");                                         \
+    stream->print(firstCol);                                     \
+    stream->print("\",");                                        \
+    for (uint8_t i = 0; i < getArrayVarCount(); i++) {           \
+        stream->print("\"");                                     \
+        printFunction(i, stream);                                \
+        stream->print("\"");                                     \
+        if (i + 1 != getArrayVarCount()) { stream->print(","); } \
+    }                                                            \
+    stream->println();
 
 // This sends a file header out over an Arduino stream
 void Logger::printFileHeader(Stream* stream) {
@@ -1004,13 +1132,13 @@ void Logger::printFileHeader(Stream* stream) {
     // Next line will be the parent sensor names
     STREAM_CSV_ROW(F("Sensor Name:"), getParentSensorNameAtI(i))
     // Next comes the ODM2 variable name
-    STREAM_CSV_ROW(F("Variable Name:"), getVarNameAtI(i))
+    STREAM_CSV_ROW_PRINTED(F("Variable Name:"), printVarNameAtI)
     // Next comes the ODM2 unit name
-    STREAM_CSV_ROW(F("Result Unit:"), getVarUnitAtI(i))
+    STREAM_CSV_ROW_PRINTED(F("Result Unit:"), printVarUnitAtI)
     // Next comes the variable UUIDs
     // We'll only add UUID's if we see a UUID for the first variable
     if (getVarUUIDAtI(0).length() > 1) {
-        STREAM_CSV_ROW(F("Result UUID:"), getVarUUIDAtI(i))
+        STREAM_CSV_ROW_PRINTED(F("Result UUID:"), printVarUUIDAtI)
     }
 
     // We'll finish up the the custom variable codes
@@ -1020,19 +1148,23 @@ void Logger::printFileHeader(Stream* stream) {
     } else if (_loggerTimeZone < 0) {
         dtRowHeader += _loggerTimeZone;
     }
-    STREAM_CSV_ROW(dtRowHeader, getVarCodeAtI(i));
+    STREAM_CSV_ROW_PRINTED(dtRowHeader, printVarCodeAtI);
 }
 
 
 // This prints a comma separated list of volues of sensor data - including the
 // time -  out over an Arduino stream
-void Logger::printSensorDataCSV(Stream* stream) {
-    String csvString = "";
-    dtFromEpoch(Logger::markedEpochTime).addToString(csvString);
-    csvString += ',';
-    stream->print(csvString);
+void Logger::printSensorDataCSV(Print* stream) {
+    // The time stamp and each value are written into the same buffer, which
+    // is long enough for either
+    char     csvText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
+    DateTime dt = dtFromEpoch(Logger::markedEpochTime);
+    writeDateTime(csvText, sizeof(csvText), dt, ' ');
+    stream->print(csvText);
+    stream->print(',');
     for (uint8_t i = 0; i < getArrayVarCount(); i++) {
-        stream->print(getValueStringAtI(i));
+        getValueTextAtI(i, csvText, sizeof(csvText));
+        stream->print(csvText);
         if (i + 1 != getArrayVarCount()) { stream->print(','); }
     }
     stream->println();
@@ -1046,6 +1178,8 @@ bool Logger::initializeSDCard(void) {
         PRINTOUT(F("Data will not be saved!"));
         return false;
     }
+    // A card kept initialized since the last record is still ready
+    if (_sdCardMounted) return true;
     // Initialise the SD card
     if (!sd.begin(_SDCardSSPin, SPI_FULL_SPEED)) {
         PRINTOUT(F("Error: SD card failed to initialize or is missing."));
@@ -1056,9 +1190,16 @@ bool Logger::initializeSDCard(void) {
         MS_DBG(F("Successfully connected to SD Card with card/slave select on "
                  "pin"),
                _SDCardSSPin);
+        _sdCardMounted = _keepFileOpen;
         return true;
     }
 }
+// Protected helper function - This forgets the open file and the card state
+void Logger::releaseSDCard(void) {
+    if (logFile.isOpen()) logFile.close();
+    _openFileName  = "";
+    _sdCardMounted = false;
+}
 
 
 // Protected helper function - This sets a timestamp on a file
@@ -1075,6 +1216,13 @@ void Logger::setFileTimestamp(File fileToStamp, uint8_t stampFlag) {
 // file name to a character file name
 bool Logger::openFile(String& filename, bool createFile,
                       bool writeDefaultHeader) {
+    // A file kept open since the last record is already at its end
+    if (_keepFileOpen && logFile.isOpen()) {
+        if (filename == _openFileName) return true;
+        logFile.close();
+        _openFileName = "";
+    }
+
     // Initialise the SD card
     // skip everything else if there's no SD card, otherwise it might hang
     if (!initializeSDCard()) return false;
@@ -1084,21 +1232,30 @@ bool Logger::openFile(String& filename, bool createFile,
     char    charFileName[fileNameLength];
     filename.toCharArray(charFileName, fileNameLength);
 
+    // The end of the data of a pre-allocated file is found by reading it
+    uint8_t openFlags = _preallocateDays > 0 ? O_RDWR : O_WRITE;
+
     // First attempt to open an already existing file (in write mode), so we
     // don't try to re-create something that's already there.
     // This should also prevent the header from being written over and over
     // in the file.
-    if (logFile.open(charFileName, O_WRITE | O_AT_END)) {
+    if (logFile.open(charFileName, openFlags | O_AT_END)) {
         MS_DBG(F("Opened existing file:"), filename);
+        if (_keepFileOpen) _openFileName = filename;
+        // Records go after the data, not after the blank end of the extent
+        if (_preallocateDays > 0) seekToDataEnd();
         // Set access date time
         setFileTimestamp(logFile, T_ACCESS);
         return true;
     } else if (createFile) {
         // Create and then open the file in write mode
-        if (logFile.open(charFileName, O_CREAT | O_WRITE | O_AT_END)) {
+        if (logFile.open(charFileName, O_CREAT | openFlags | O_AT_END)) {
             MS_DBG(F("Created new file:"), filename);
+            if (_keepFileOpen) _openFileName = filename;
             // Set creation date time
             setFileTimestamp(logFile, T_CREATE);
+            // Allocate the whole file before anything is written to it
+            if (_preallocateDays > 0) preallocateFile(writeDefaultHeader);
             // Write out a header, if requested
             if (writeDefaultHeader) {
                 // Add header information
@@ -1127,6 +1284,126 @@ bool Logger::openFile(String& filename, bool createFile,
         return false;
     }
 }
+// Counts the characters printed to it, to size a file before writing it
+class PrintLengthCounter : public Stream {
+ public:
+    uint32_t length = 0;
+    size_t   write(uint8_t) override {
+        length++;
+        return 1;
+    }
+    int available() override {
+        return 0;
+    }
+    int read() override {
+        return -1;
+    }
+    int peek() override {
+        return -1;
+    }
+    void flush() override {}
+};
+
+// Protected helper function - This allocates and erases the whole extent of a
+// new, empty file
+bool Logger::preallocateFile(bool writeDefaultHeader) {
+    // The header and a record are printed once only to measure them
+    PrintLengthCounter counter;
+    if (writeDefaultHeader) printFileHeader(&counter);
+    uint32_t headerLength = counter.length;
+    counter.length        = 0;
+    printSensorDataCSV(&counter);
+    uint32_t recordLength = counter.length + counter.length / 4;
+    uint32_t recordCount  = static_cast<uint32_t>(_preallocateDays) * 1440 /
+        (_loggingIntervalMinutes > 0 ? _loggingIntervalMinutes : 1);
+    uint32_t extent = headerLength + recordCount * recordLength;
+
+    uint32_t firstSector;
+    uint32_t lastSector;
+    if (!logFile.preAllocate(extent) ||
+        !logFile.contiguousRange(&firstSector, &lastSector)) {
+        MS_DBG(F("Unable to pre-allocate"), extent, F("bytes"));
+        logFile.truncate(0);
+        return false;
+    }
+    // Erased sectors read back as all 0x00 or all 0xFF, which marks where
+    // the data ends
+    if (!sd.card()->erase(firstSector, lastSector)) {
+        MS_DBG(F("Unable to erase the pre-allocated extent"));
+        logFile.truncate(0);
+        return false;
+    }
+    MS_DBG(F("Pre-allocated"), extent, F("bytes for"), recordCount,
+           F("records"));
+    return true;
+}
+
+
+// The blank, erased part of a pre-allocated file reads as all 0x00 or all
+// 0xFF; neither is ever in the text of a record
+static bool isBlankByte(int c) {
+    return c == 0x00 || c == 0xFF;
+}
+
+// Protected helper function - This finds the end of the data in a file
+bool Logger::seekToDataEnd(void) {
+    uint32_t fileSize = logFile.fileSize();
+    // A file that doesn't end blank wasn't pre-allocated or is full
+    if (fileSize == 0 || !logFile.seekSet(fileSize - 1) ||
+        !isBlankByte(logFile.read())) {
+        return logFile.seekSet(fileSize);
+    }
+
+    // The data only ever fills the start of the file, so the first block
+    // that starts blank is found by a binary search
+    uint32_t low  = 0;
+    uint32_t high = (fileSize + MS_SD_BLOCK_SIZE - 1) / MS_SD_BLOCK_SIZE;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        if (!logFile.seekSet(middle * MS_SD_BLOCK_SIZE)) return false;
+        if (isBlankByte(logFile.read())) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    // The data ends within the block before that one
+    uint32_t position = low > 0 ? (low - 1) * MS_SD_BLOCK_SIZE : 0;
+    uint32_t blockEnd = low * MS_SD_BLOCK_SIZE;
+    if (blockEnd > fileSize) blockEnd = fileSize;
+    if (!logFile.seekSet(position)) return false;
+    while (position < blockEnd && !isBlankByte(logFile.read())) position++;
+    MS_DBG(F("Data ends at"), position, F("of"), fileSize, F("bytes"));
+    return logFile.seekSet(position);
+}
+
+
+// This cuts a pre-allocated file off at the end of its data
+bool Logger::trimLogFile(void) {
+    // Records still in RAM belong in the file before it is cut off
+    // A file that was never written is not created just to trim it
+    if (!writeBufferedRecords(false) || !openBufferedFile(false)) {
+        return false;
+    }
+    bool success = seekToDataEnd() && logFile.truncate(logFile.curPosition());
+    MS_DBG(F("Trimmed"), _fileName, F("to"), logFile.fileSize(), F("bytes"));
+    return finishFileWrite() && success;
+}
+
+
+// Protected helper function - This closes the file, or syncs it to the card
+// if it is being kept open
+bool Logger::finishFileWrite(void) {
+    if (!_keepFileOpen) {
+        logFile.close();
+        return true;
+    }
+    if (logFile.sync()) return true;
+    // The card may have been removed; start it over for the next record
+    PRINTOUT(F("Error: Unable to sync the file to the SD card."));
+    releaseSDCard();
+    return false;
+}
 
 
 // These functions create a file on the SD card with the given filename and
@@ -1139,9 +1416,8 @@ bool Logger::openFile(String& filename, bool createFile,
 bool Logger::createLogFile(String& filename, bool writeDefaultHeader) {
     // Attempt to create and open a file
     if (openFile(filename, true, writeDefaultHeader)) {
-        // Close the file to save it (only do this if we'd opened it)
-        // logFile.sync();
-        logFile.close();
+        // Save the file (only do this if we'd opened it)
+        finishFileWrite();
         PRINTOUT(F("Data will be saved as"), _fileName);
         return true;
     } else {
@@ -1162,6 +1438,9 @@ bool Logger::createLogFile(bool writeDefaultHeader) {
 // the file does not already exist, the file will be created. This can be used
 // to force a logger to write to a file with a secondary file name.
 bool Logger::logToSD(String& filename, String& rec) {
+    // Records buffered for the same file go ahead of this one
+    if (filename == _fileName) writeBufferedRecords(false);
+
     // First attempt to open the file without creating a new one
     if (!openFile(filename, false, false)) {
         // Next try to create the file, bail if we couldn't create it
@@ -1182,10 +1461,8 @@ bool Logger::logToSD(String& filename, String& rec) {
     setFileTimestamp(logFile, T_WRITE);
     // Set access date time
     setFileTimestamp(logFile, T_ACCESS);
-    // Close the file to save it
-    // logFile.sync();
-    logFile.close();
-    return true;
+    // Close the file to save it, or sync it if it is being kept open
+    return finishFileWrite();
 }
 bool Logger::logToSD(String& rec) {
     // Get a new file name if the name is blank
@@ -1197,6 +1474,8 @@ bool Logger::logToSD(String& rec) {
 bool Logger::logToSD(void) {
     // Get a new file name if the name is blank
     if (_fileName == "") generateAutoFileName();
+    // Hold the record in RAM if there's a buffer for it
+    if (_sdWriteBuffer != NULL) return bufferRecord();
 
     // First attempt to open the file without creating a new one
     if (!openFile(_fileName, false, false)) {
@@ -1223,11 +1502,94 @@ bool Logger::logToSD(void) {
     setFileTimestamp(logFile, T_WRITE);
     // Set access date time
     setFileTimestamp(logFile, T_ACCESS);
-    // Close the file to save it
-    // logFile.sync();
-    logFile.close();
+    // Close the file to save it, or sync it if it is being kept open
+    return finishFileWrite();
+}
+// This prints a record into the RAM buffer and writes the buffer to the card
+// when it is due
+bool Logger::bufferRecord(void) {
+    // The file is opened once first, so the buffer knows where in a block the
+    // file ends
+    if (!_sdWriteBuffer->hasPosition()) {
+        if (!openBufferedFile() || !finishFileWrite()) {
+            PRINTOUT(F("Unable to write to SD card!"));
+            return false;
+        }
+    }
+    _sdWriteBuffer->beginRecord(Logger::markedEpochTime);
+    printSensorDataCSV(_sdWriteBuffer);
+    if (!_sdWriteBuffer->endRecord()) {
+        // Make room by writing out everything held so far, then try again
+        if (!writeBufferedRecords(false)) {
+            PRINTOUT(F("Unable to write to SD card!"));
+            return false;
+        }
+        _sdWriteBuffer->beginRecord(Logger::markedEpochTime);
+        printSensorDataCSV(_sdWriteBuffer);
+        if (!_sdWriteBuffer->endRecord()) {
+            // A record longer than the whole buffer goes straight to the file
+            if (!openBufferedFile()) {
+                PRINTOUT(F("Unable to write to SD card!"));
+                return false;
+            }
+            printSensorDataCSV(&logFile);
+            setFileTimestamp(logFile, T_WRITE);
+            setFileTimestamp(logFile, T_ACCESS);
+            if (!finishFileWrite()) return false;
+        }
+    }
+// Echo the line to the serial port
+#if defined(STANDARD_SERIAL_OUTPUT)
+    PRINTOUT(F("\n \\/---- Line Buffered for SD Card ----\\/"));
+    printSensorDataCSV(&STANDARD_SERIAL_OUTPUT);
+    PRINTOUT('\n');
+#endif
+
+    // Write out whole blocks once there are any, or everything once the
+    // oldest record has waited long enough
+    if (_sdWriteBuffer->isTooOld(Logger::markedEpochTime)) {
+        return writeBufferedRecords(false);
+    }
+    if (_sdWriteBuffer->hasFullBlock()) return writeBufferedRecords(true);
     return true;
 }
+// This powers up the card if needed and opens the log file, creating it with
+// a header if it isn't there yet
+bool Logger::openBufferedFile(bool createFile) {
+    if (_fileName == "") generateAutoFileName();
+    // Records held in RAM didn't need the card, so it may still be off
+    if (_SDCardPowerPin >= 0 && !_SDCardPowerPinHandle.read()) {
+        turnOnSDcard(true);
+    }
+    if (!openFile(_fileName, false, false) &&
+        !(createFile && openFile(_fileName, true, true))) {
+        return false;
+    }
+    if (_sdWriteBuffer != NULL) {
+        _sdWriteBuffer->setPosition(logFile.curPosition());
+    }
+    return true;
+}
+// This numbers the update cycles by logging intervals since the epoch; an
+// interval of 0 is never rejected, so it is treated as 1 minute
+uint32_t Logger::getUpdateCycle(void) {
+    uint32_t interval_s = 60L *
+        (_loggingIntervalMinutes > 0 ? _loggingIntervalMinutes : 1);
+    return Logger::markedEpochTime / interval_s;
+}
+// This writes the RAM buffer to the end of the log file
+bool Logger::writeBufferedRecords(bool wholeBlocksOnly) {
+    if (_sdWriteBuffer == NULL || _sdWriteBuffer->isEmpty()) return true;
+    if (!openBufferedFile()) return false;
+    bool success = _sdWriteBuffer->writeTo(&logFile, logFile.curPosition(),
+                                           wholeBlocksOnly);
+    // Set write/modification date time
+    setFileTimestamp(logFile, T_WRITE);
+    // Set access date time
+    setFileTimestamp(logFile, T_ACCESS);
+    // Close the file to save it, or sync it if it is being kept open
+    return finishFileWrite() && success;
+}
 
 
 // ===================================================================== //
@@ -1245,9 +1607,9 @@ void Logger::checkForTestingMode(int8_t buttonPin)
     // Flash the LED to let user know it is now possible to enter debug mode
     for (uint8_t i = 0; i < 15; i++)
     {
-        digitalWrite(_ledPin, HIGH);
+        _ledPinHandle.write(HIGH);
         delay(50);
-        digitalWrite(_ledPin, LOW);
+        _ledPinHandle.write(LOW);
         delay(50);
     }
 
@@ -1390,7 +1752,7 @@ void Logger::begin() {
     // Set pin modes for sd card power
     if (_SDCardPowerPin >= 0) {
         pinMode(_SDCardPowerPin, OUTPUT);
-        digitalWrite(_SDCardPowerPin, LOW);
+        _SDCardPowerPinHandle.write(LOW);
         MS_DBG(F("Pin"), _SDCardPowerPin, F("set as SD Card Power Pin"));
     }
     // Set pin modes for sd card slave select (aka chip select)
@@ -1489,15 +1851,18 @@ void Logger::logData(void) {
         PRINTOUT(F("------------------------------------------"));
         // Turn on the LED to show we're taking a reading
         alertOn();
-        // Power up the SD Card
+        // Power up the SD Card, unless the record is only going into the RAM
+        // buffer; the card is powered up when the buffer is written
         // TODO(SRGDamia1):  Decide how much delay is needed between turning on
         // the card and writing to it.  Could we turn it on just before writing?
-        turnOnSDcard(false);
+        if (_sdWriteBuffer == NULL) turnOnSDcard(false);
 
         // Do a complete sensor update
         MS_DBG(F("    Running a complete sensor update..."));
         watchDogTimer.resetWatchDog();
-        _internalArray->completeUpdate();
+        // The update cycle is the number of logging intervals since the
+        // epoch, so sensors sampled less often stay aligned to the clock
+        _internalArray->completeUpdate(getUpdateCycle());
         watchDogTimer.resetWatchDog();
 
         // Create a csv data record and save it to the log file
@@ -1537,10 +1902,11 @@ void Logger::logDataAndPublish(void) {
         PRINTOUT(F("------------------------------------------"));
         // Turn on the LED to show we're taking a reading
         alertOn();
-        // Power up the SD Card
+        // Power up the SD Card, unless the record is only going into the RAM
+        // buffer; the card is powered up when the buffer is written
         // TODO(SRGDamia1):  Decide how much delay is needed between turning on
         // the card and writing to it.  Could we turn it on just before writing?
-        turnOnSDcard(false);
+        if (_sdWriteBuffer == NULL) turnOnSDcard(false);
 
         // Do a complete update on the variable array.
         // This this includes powering all of the sensors, getting updated
@@ -1549,7 +1915,9 @@ void Logger::logDataAndPublish(void) {
         // to run if the sensor was not previously set up.
         MS_DBG(F("Running a complete sensor update..."));
         watchDogTimer.resetWatchDog();
-        _internalArray->completeUpdate();
+        // The update cycle is the number of logging intervals since the
+        // epoch, so sensors sampled less often stay aligned to the clock
+        _internalArray->completeUpdate(getUpdateCycle());
         watchDogTimer.resetWatchDog();
 
         // Create a csv data record and save it to the log file
@@ -26,6 +26,8 @@
 #undef MS_DEBUGGING_STD
 #include "VariableArray.h"
 #include "LoggerModem.h"
+#include "PinHandle.h"
+#include "SDWriteBuffer.h"
 
 // Bring in the libraries to handle the processor sleep/standby modes
 // The SAMD library can also the built-in clock on those modules
@@ -242,6 +244,83 @@ class Logger {
      * to the SD card.
      */
     void setSDCardPins(int8_t SDCardSSPin, int8_t SDCardPowerPin);
+    /**
+     * @brief Keep the SD card initialized and the log file open between
+     * records.
+     *
+     * Each record is then appended to the file that is already open and
+     * synced to the card.  Otherwise the card is initialized, the file opened
+     * and walked to its end, and the file closed again for every record.  The
+     * card is only initialized again and the file reopened after
+     * turnOffSDcard() has actually cut the power to the card, after a sync
+     * fails, or when writing to a different file.
+     *
+     * @param keepFileOpen True to keep the file open; false, the default, to
+     * close it after every record.
+     */
+    void setKeepFileOpen(bool keepFileOpen);
+    /**
+     * @brief Hold records in a RAM buffer and write them to the SD card in
+     * whole blocks.
+     *
+     * While a buffer is set, logToSD() prints each record into the buffer
+     * and only writes to the card once a block of the file can be filled or
+     * the oldest record is too old; see SDWriteBuffer.  logData() and
+     * logDataAndPublish() then only power the card when it is written to.
+     * Anything buffered is written before turnOffSDcard() cuts power to the
+     * card.
+     *
+     * @param writeBuffer The write buffer, or NULL to write every record as it
+     * is made.
+     */
+    void setSDWriteBuffer(SDWriteBuffer* writeBuffer);
+    /**
+     * @brief Write everything in the RAM buffer to the SD card now.
+     *
+     * Call this before anything that might keep the logger from coming back
+     * to write the buffer, like a very long sleep.  The card is powered up if
+     * it is off, and left on.
+     *
+     * @return **bool** True if the buffer is empty or was written.
+     */
+    bool flushSDWriteBuffer(void);
+    /**
+     * @brief Pre-allocate each new log file as one contiguous extent, sized
+     * for a number of days of records.
+     *
+     * The size comes from the header, the logging interval, and the width of
+     * a record, plus a quarter for records that print longer.  The extent is
+     * erased on the card, so the part after the data reads as blank bytes
+     * until it is written.  Appends inside the extent then never allocate
+     * clusters or update the FAT, and the write position is found without
+     * following the cluster chain.  When a pre-allocated file is opened again,
+     * the end of its data is found by a binary search for the first blank
+     * block.  A file that outgrows its extent keeps growing as usual.
+     *
+     * @note Until the extent fills, or the file is trimmed, the end of the
+     * file is blank.  A file is trimmed when setFileName() moves the logger
+     * on to a new file or when trimLogFile() is called.  The file still being
+     * written, and one left behind by a reset before it was trimmed, keep
+     * their blank end; programs reading them straight off the card must stop
+     * at the first 0x00 or 0xFF byte.  Leave this set for as long as the file
+     * is written to, so records are never appended after the blank part.
+     *
+     * @param days The number of days of records to allocate space for; 0, the
+     * default, to let files grow as records are written.
+     */
+    void setFilePreallocation(uint16_t days);
+    /**
+     * @brief Cut a pre-allocated log file off at the end of its data,
+     * freeing the rest of its extent.
+     *
+     * setFileName() does this for the old file when the name changes; use
+     * this for the last file, once no more records will be written to it,
+     * such as at the end of a deployment.  A file that doesn't exist yet is
+     * not created.
+     *
+     * @return **bool** True if the file was trimmed.
+     */
+    bool trimLogFile(void);
 
     //
     /**
@@ -328,6 +407,10 @@ class Logger {
      * @brief Digital pin number on the mcu controlling SD card power
      */
     int8_t _SDCardPowerPin;
+    /**
+     * @brief The port and bit of the #_SDCardPowerPin, looked up once.
+     */
+    PinHandle _SDCardPowerPinHandle;
     /**
      * @brief Digital pin number on the mcu receiving interrupts to wake from
      * deep-sleep.
@@ -340,6 +423,10 @@ class Logger {
      * Expected to be connected to a LED.
      */
     int8_t _ledPin;
+    /**
+     * @brief The port and bit of the #_ledPin, looked up once.
+     */
+    PinHandle _ledPinHandle;
     /**
      * @brief Digital pin number on the mcu receiving interrupts to enter
      * testing mode.
@@ -436,6 +523,56 @@ class Logger {
      * @return **String** The variable UUID
      */
     String getVarUUIDAtI(uint8_t position_i);
+    /**
+     * @brief Write the UUID of the variable at the given position in the
+     * internal variable array object into a character buffer.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param buffer The buffer to write into; 37 characters are enough for
+     * any correctly formatted UUID.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator.
+     */
+    uint8_t getVarUUIDTextAtI(uint8_t position_i, char* buffer,
+                              size_t bufferSize);
+    /**
+     * @brief Print the name of the variable at the given position in the
+     * internal variable array object, straight from flash if it is kept there.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarNameAtI(uint8_t position_i, Print* stream);
+    /**
+     * @brief Print the unit of the variable at the given position in the
+     * internal variable array object, straight from flash if it is kept there.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarUnitAtI(uint8_t position_i, Print* stream);
+    /**
+     * @brief Print the customized code of the variable at the given position
+     * in the internal variable array object, straight from flash if it is kept
+     * there.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarCodeAtI(uint8_t position_i, Print* stream);
+    /**
+     * @brief Print the UUID of the variable at the given position in the
+     * internal variable array object.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarUUIDAtI(uint8_t position_i, Print* stream);
     /**
      * @brief Get the most recent value of the variable at the given position in
      * the internal variable array object.
@@ -445,6 +582,18 @@ class Logger {
      * number of significant figures.
      */
     String getValueStringAtI(uint8_t position_i);
+    /**
+     * @brief Write the most recent value of the variable at the given position
+     * in the internal variable array object into a character buffer.
+     *
+     * @param position_i The position of the variable in the array.
+     * @param buffer The buffer to write into.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator; 0 if the value doesn't fit in the buffer.
+     */
+    uint8_t getValueTextAtI(uint8_t position_i, char* buffer,
+                            size_t bufferSize);
 
  protected:
     /**
@@ -663,6 +812,21 @@ class Logger {
      * @return **String** An ISO8601 formatted String.
      */
     static String formatDateTime_ISO8601(uint32_t epochTime);
+    /**
+     * @brief Write an epoch time (unix time) as an ISO8601 formatted date and
+     * time into a character buffer.
+     *
+     * This assumes the supplied date/time is in the LOGGER's timezone and adds
+     * the LOGGER's offset as the time zone offset in the text.
+     *
+     * @param buffer The buffer to write into; 26 characters are always enough.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @param epochTime The number of seconds since 1970.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator; 0 if the text doesn't fit in the buffer.
+     */
+    static uint8_t formatDateTime_ISO8601(char* buffer, size_t bufferSize,
+                                          uint32_t epochTime);
 
     /**
      * @brief Veify that the input value is sane and if so sets the real time
@@ -813,6 +977,9 @@ class Logger {
      * If the file name is set using this function, the same file name will be
      * used for every single file created by the logger.
      *
+     * If files are pre-allocated, the file the logger was writing to is
+     * trimmed with trimLogFile() before the name changes.
+     *
      * @param fileName  The file name
      */
     void setFileName(String& fileName);
@@ -845,10 +1012,11 @@ class Logger {
      * @brief Print a comma separated list of volues of sensor data -
      * including the time in the logging timezone -  out over an Arduino stream
      *
-     * @param stream An Arduino stream instance - expected to be an SdFat file -
-     * but could also be the "main" Serial port for debugging.
+     * @param stream An Arduino stream instance - expected to be an SdFat file
+     * or an SDWriteBuffer - but could also be the "main" Serial port for
+     * debugging.
      */
-    void printSensorDataCSV(Stream* stream);
+    void printSensorDataCSV(Print* stream);
 
     /**
      * @brief Create a file on the SD card and set the created, modified, and
@@ -931,6 +1099,27 @@ class Logger {
      * @brief An internal reference to an SdFat file instance
      */
     File logFile;
+    /**
+     * @brief The name of the file held open in #logFile between records
+     */
+    String _openFileName;
+    /**
+     * @brief True to keep #logFile open between records
+     */
+    bool _keepFileOpen;
+    /**
+     * @brief True while the SD card is initialized and being kept that way
+     */
+    bool _sdCardMounted;
+    /**
+     * @brief The RAM buffer records are held in, if any
+     */
+    SDWriteBuffer* _sdWriteBuffer;
+    /**
+     * @brief The number of days of records new log files are pre-allocated
+     * for; 0 if they aren't
+     */
+    uint16_t _preallocateDays;
     /**
      * @brief An internal reference to the current filename
      */
@@ -945,6 +1134,11 @@ class Logger {
      * @return **bool** True if the SD card is ready
      */
     bool initializeSDCard(void);
+    /**
+     * @brief Close any file held open and mark the SD card as needing to be
+     * initialized again.
+     */
+    void releaseSDCard(void);
 
     /**
      * @brief Generate a file name from the logger id and the current date.
@@ -973,6 +1167,64 @@ class Logger {
      * @return **bool** True if a file was successfully opened or created.
      */
     bool openFile(String& filename, bool createFile, bool writeDefaultHeader);
+    /**
+     * @brief Finish writing to the log file; close it, or only sync it to the
+     * card if it is being kept open.
+     *
+     * @return **bool** True unless a sync of a file being kept open failed.
+     */
+    bool finishFileWrite(void);
+    /**
+     * @brief Print a record into the RAM buffer, writing out the buffer first
+     * if the record doesn't fit and afterwards if a write is due.
+     *
+     * @return **bool** True if the record was kept and any write succeeded.
+     */
+    bool bufferRecord(void);
+    /**
+     * @brief Write the RAM buffer to the log file, powering up the card if it
+     * is off.
+     *
+     * @param wholeBlocksOnly True to write only whole blocks of the file.
+     * @return **bool** True if the buffer was written.
+     */
+    bool writeBufferedRecords(bool wholeBlocksOnly);
+    /**
+     * @brief Power up the SD card if it is off and open the log file for the
+     * RAM buffer, creating it with a header if it doesn't exist.
+     *
+     * The buffer is told where the file ends, so it knows where the next block
+     * boundary is.
+     *
+     * @param createFile False to only open a file that already exists.
+     * @return **bool** True if the file is open.
+     */
+    bool openBufferedFile(bool createFile = true);
+    /**
+     * @brief Get the number of logging intervals from the epoch to the marked
+     * time, which numbers the sensor update cycles.
+     *
+     * A logging interval of 0 minutes is counted as 1 minute.
+     *
+     * @return **uint32_t** The update cycle.
+     */
+    uint32_t getUpdateCycle(void);
+    /**
+     * @brief Allocate a contiguous, erased extent for a newly created, empty
+     * log file.
+     *
+     * @param writeDefaultHeader True if a header will be written to the file.
+     * @return **bool** True if the extent was allocated.  Otherwise the file
+     * is left empty, to grow as usual.
+     */
+    bool preallocateFile(bool writeDefaultHeader);
+    /**
+     * @brief Move the position of an opened log file to the end of its data,
+     * before the blank part of a pre-allocated extent.
+     *
+     * @return **bool** True if the end of the data was found.
+     */
+    bool seekToDataEnd(void);
     /**@}*/
 
     // ===================================================================== //
@@ -37,7 +37,11 @@ loggerModem::loggerModem(int8_t powerPin, int8_t statusPin, bool statusLevel,
       _wakeDelayTime_ms(wakeDelayTime_ms),
       _max_atresponse_time_ms(max_atresponse_time_ms), _modemLEDPin(-1),
       _millisPowerOn(0), _lastNISTrequest(0), _hasBeenSetup(false),
-      _pinModesSet(false), _modemName("unspecified modem") {}
+      _pinModesSet(false), _modemName("unspecified modem") {
+    _powerPinHandle.attach(powerPin);
+    _statusPinHandle.attach(statusPin);
+    _modemSleepRqPinHandle.attach(modemSleepRqPin);
+}
 
 
 // Destructor
@@ -46,16 +50,17 @@ loggerModem::~loggerModem() {}
 
 void loggerModem::setModemLED(int8_t modemLEDPin) {
     _modemLEDPin = modemLEDPin;
+    _modemLEDPinHandle.attach(modemLEDPin);
     if (_modemLEDPin >= 0) {
         pinMode(_modemLEDPin, OUTPUT);
-        digitalWrite(_modemLEDPin, LOW);
+        _modemLEDPinHandle.write(LOW);
     }
 }
 void loggerModem::modemLEDOn(void) {
-    if (_modemLEDPin >= 0) { digitalWrite(_modemLEDPin, HIGH); }
+    if (_modemLEDPin >= 0) { _modemLEDPinHandle.write(HIGH); }
 }
 void loggerModem::modemLEDOff(void) {
-    if (_modemLEDPin >= 0) { digitalWrite(_modemLEDPin, LOW); }
+    if (_modemLEDPin >= 0) { _modemLEDPinHandle.write(LOW); }
 }
 
 String loggerModem::getModemName(void) {
@@ -68,11 +73,11 @@ void loggerModem::modemPowerUp(void) {
             // For most modules, the sleep pin should be held high during power
             // up. After some warm-up time, that pin is usually pulsed low to
             // wake the module.
-            digitalWrite(_modemSleepRqPin, !_wakeLevel);
+            _modemSleepRqPinHandle.write(!_wakeLevel);
         }
         MS_DBG(F("Powering"), getModemName(), F("with pin"), _powerPin);
         pinMode(_powerPin, OUTPUT);
-        digitalWrite(_powerPin, HIGH);
+        _powerPinHandle.write(HIGH);
         // Mark the time that the sensor was powered
         _millisPowerOn = millis();
     } else {
@@ -92,7 +97,7 @@ void loggerModem::modemPowerDown(void) {
 
         MS_DBG(F("Turning off power to"), getModemName(), F("with pin"),
                _powerPin);
-        digitalWrite(_powerPin, LOW);
+        _powerPinHandle.write(LOW);
         // Unset the power-on time
         _millisPowerOn = 0;
     } else {
@@ -210,8 +215,8 @@ bool loggerModem::modemSleepPowerDown(void) {
                    _statusPin, F("going"), !_statusLevel ? F("HIGH") : F("LOW"),
                    F("..."));
             while (millis() - start < _disconnetTime_ms &&
-                   digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {}
-            if (digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {
+                   _statusPinHandle.read() == _statusLevel) {}
+            if (_statusPinHandle.read() == _statusLevel) {
                 MS_DBG(F("... "), getModemName(),
                        F("did not successfully shut down!"));
             } else {
@@ -231,7 +236,7 @@ bool loggerModem::modemSleepPowerDown(void) {
 
         MS_DBG(F("Turning off power to"), getModemName(), F("with pin"),
                _powerPin);
-        digitalWrite(_powerPin, LOW);
+        _powerPinHandle.write(LOW);
         // Unset the power-on time
         _millisPowerOn = 0;
     } else {
@@ -292,7 +297,7 @@ void loggerModem::setModemPinModes(void) {
                    F("for modem sleep with starting value"),
                    !_wakeLevel ? F("HIGH") : F("LOW"));
             pinMode(_modemSleepRqPin, OUTPUT);
-            digitalWrite(_modemSleepRqPin, !_wakeLevel);
+            _modemSleepRqPinHandle.write(!_wakeLevel);
         }
         if (_modemResetPin >= 0) {
             MS_DBG(F("Initializing pin"), _modemResetPin,
@@ -305,7 +310,7 @@ void loggerModem::setModemPinModes(void) {
             MS_DBG(F("Initializing pin"), _modemLEDPin,
                    F("for modem status LED with starting value 0"));
             pinMode(_modemLEDPin, OUTPUT);
-            digitalWrite(_modemLEDPin, LOW);
+            _modemLEDPinHandle.write(LOW);
         }
         _pinModesSet = true;
     }
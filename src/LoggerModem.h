@@ -34,6 +34,7 @@
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
 #include "VariableBase.h"
+#include "PinHandle.h"
 #include <Arduino.h>
 
 
@@ -800,6 +801,10 @@ class loggerModem {
      * powered or the power cannot be controlled by the MCU.
      */
     int8_t _powerPin;
+    /**
+     * @brief The port and bit of the #_powerPin, looked up once.
+     */
+    PinHandle _powerPinHandle;
     /**
      * @brief The digital pin number of the mcu pin connected to the modem
      * status output pin.
@@ -808,6 +813,10 @@ class loggerModem {
      * read.
      */
     int8_t _statusPin;
+    /**
+     * @brief The port and bit of the #_statusPin, looked up once.
+     */
+    PinHandle _statusPinHandle;
     /**
      * @brief The level (`LOW` or `HIGH`) of the #_statusPin when the modem
      * is active.
@@ -839,6 +848,10 @@ class loggerModem {
      * sleep modes or it is not accessible to the MCU.
      */
     int8_t _modemSleepRqPin;
+    /**
+     * @brief The port and bit of the #_modemSleepRqPin, looked up once.
+     */
+    PinHandle _modemSleepRqPinHandle;
     /**
      * @brief The level (`LOW` or `HIGH`) on the #_modemSleepRqPin used to
      * **wake** the modem.
@@ -897,6 +910,10 @@ class loggerModem {
      * Should be set to a negative number if no LED is available.
      */
     int8_t _modemLEDPin;
+    /**
+     * @brief The port and bit of the #_modemLEDPin, looked up once.
+     */
+    PinHandle _modemLEDPinHandle;
 
     /**
      * @brief The processor elapsed time when the power was turned on for the
@@ -0,0 +1,152 @@
+/**
+ * @file PinHandle.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the PinHandle class, for fast reads and writes of a pin
+ * whose port and bit are looked up only once.
+ */
+
+// Header Guards
+#ifndef SRC_PINHANDLE_H_
+#define SRC_PINHANDLE_H_
+
+// Included Dependencies
+#include <Arduino.h>
+#include <pins_arduino.h>
+
+/**
+ * @brief A digital pin with its port registers and bit mask looked up once,
+ * when the pin is attached.
+ *
+ * Reading the level of a pin from its port input register works for output
+ * pins as well as input pins, so this is used to check whether power and
+ * status pins are on without changing them.  Writes go directly to the port
+ * registers; the pin mode must still be set with pinMode().  On SAMD boards
+ * they go to the port's set and clear registers, so no write ever changes
+ * another pin of the port.
+ *
+ * A handle with no pin attached, or with a pin that isn't on any port, reads
+ * `LOW` and ignores writes.
+ */
+class PinHandle {
+ public:
+    /**
+     * @brief The type of a port register of the board; an 8-bit register on
+     * AVR boards and a 32-bit one on SAMD boards.
+     */
+    typedef decltype(portInputRegister(digitalPinToPort(0))) portRegister;
+    /**
+     * @brief The type of the bit mask of a pin within its port register.
+     */
+    typedef decltype(digitalPinToBitMask(0)) portMask;
+
+    /**
+     * @brief Construct a new PinHandle object with no pin attached.
+     */
+    PinHandle() {
+        detach();
+    }
+
+    /**
+     * @brief Look up the port registers and bit mask of a pin.
+     *
+     * @param pin The digital pin number; a negative number, or a pin that
+     * isn't on any port, detaches the handle.
+     */
+    void attach(int8_t pin) {
+        if (pin < 0) {
+            detach();
+            return;
+        }
+#if defined ARDUINO_ARCH_SAMD
+        // The same check as digitalRead() and digitalWrite()
+        if (g_APinDescription[pin].ulPinType == PIO_NOT_A_PIN) {
+            detach();
+            return;
+        }
+        _inputRegister       = portInputRegister(digitalPinToPort(pin));
+        _outputSetRegister   = &digitalPinToPort(pin)->OUTSET.reg;
+        _outputClearRegister = &digitalPinToPort(pin)->OUTCLR.reg;
+#else
+        // The port registers of a pin that isn't on a port are NULL
+        if (digitalPinToPort(pin) == NOT_A_PIN) {
+            detach();
+            return;
+        }
+        _inputRegister  = portInputRegister(digitalPinToPort(pin));
+        _outputRegister = portOutputRegister(digitalPinToPort(pin));
+#endif
+        _mask = digitalPinToBitMask(pin);
+    }
+
+    /**
+     * @brief Check whether a pin is attached.
+     *
+     * @return **bool** True if a pin is attached.
+     */
+    bool isAttached(void) const {
+        return _mask != 0;
+    }
+
+    /**
+     * @brief Read the current level of the pin.
+     *
+     * @return **bool** The level; `HIGH` or `LOW`.
+     */
+    bool read(void) const {
+        if (_mask == 0) return LOW;
+        return (*_inputRegister & _mask) ? HIGH : LOW;
+    }
+
+    /**
+     * @brief Set the output level of the pin.
+     *
+     * @param level The level; `HIGH` or `LOW`.
+     */
+    void write(bool level) {
+        if (_mask == 0) return;
+#if defined ARDUINO_ARCH_SAMD
+        // Each is a single store that only changes the bits set in it
+        if (level) {
+            *_outputSetRegister = _mask;
+        } else {
+            *_outputClearRegister = _mask;
+        }
+#else
+        // The read-modify-write of the port isn't atomic; the interrupt flag
+        // is put back as it was rather than always turned on
+        uint8_t oldSREG = SREG;
+        cli();
+        if (level) {
+            *_outputRegister |= _mask;
+        } else {
+            *_outputRegister &= ~_mask;
+        }
+        SREG = oldSREG;
+#endif
+    }
+
+ private:
+    void detach(void) {
+        _inputRegister = NULL;
+#if defined ARDUINO_ARCH_SAMD
+        _outputSetRegister   = NULL;
+        _outputClearRegister = NULL;
+#else
+        _outputRegister = NULL;
+#endif
+        _mask = 0;
+    }
+
+    portRegister _inputRegister;
+#if defined ARDUINO_ARCH_SAMD
+    portRegister _outputSetRegister;
+    portRegister _outputClearRegister;
+#else
+    portRegister _outputRegister;
+#endif
+    portMask _mask;
+};
+
+#endif  // SRC_PINHANDLE_H_
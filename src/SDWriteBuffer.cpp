@@ -0,0 +1,116 @@
+/**
+ * @file SDWriteBuffer.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the SDWriteBuffer class.
+ */
+
+#include "SDWriteBuffer.h"
+
+
+// The constructor - needs the buffer and how long records may wait in it
+SDWriteBuffer::SDWriteBuffer(uint8_t* buffer, uint16_t bufferSize,
+                             uint32_t maxAge_s) {
+    _buffer           = buffer;
+    _bufferSize       = bufferSize;
+    _maxAge_s         = maxAge_s;
+    _length           = 0;
+    _recordStart      = 0;
+    _recordLength     = 0;
+    _blockOffset      = 0;
+    _positionKnown    = false;
+    _oldestRecordTime = 0;
+    _recordTime       = 0;
+}
+// Destructor
+SDWriteBuffer::~SDWriteBuffer() {}
+
+
+// Characters past the end of the buffer are counted but not kept
+size_t SDWriteBuffer::write(uint8_t c) {
+    if (_recordLength < UINT16_MAX) _recordLength++;
+    if (_recordStart + _recordLength <= _bufferSize) _buffer[_length++] = c;
+    return 1;
+}
+
+
+void SDWriteBuffer::beginRecord(uint32_t recordTime) {
+    _recordStart  = _length;
+    _recordLength = 0;
+    _recordTime   = recordTime;
+}
+
+
+bool SDWriteBuffer::endRecord(void) {
+    if (_recordStart + _recordLength > _bufferSize) {
+        MS_DBG(F("Record of"), _recordLength, F("bytes doesn't fit in the"),
+               _bufferSize - _recordStart, F("left in the buffer"));
+        _length = _recordStart;
+        return false;
+    }
+    if (_recordStart == 0) _oldestRecordTime = _recordTime;
+    return true;
+}
+
+
+uint16_t SDWriteBuffer::getRecordLength(void) {
+    return _recordLength;
+}
+
+
+uint16_t SDWriteBuffer::getFree(void) {
+    return _bufferSize - _length;
+}
+
+
+bool SDWriteBuffer::isEmpty(void) {
+    return _length == 0;
+}
+
+
+void SDWriteBuffer::setPosition(uint32_t position) {
+    _blockOffset   = position % MS_SD_BLOCK_SIZE;
+    _positionKnown = true;
+}
+
+
+bool SDWriteBuffer::hasPosition(void) {
+    return _positionKnown;
+}
+
+
+bool SDWriteBuffer::hasFullBlock(void) {
+    return static_cast<uint32_t>(_blockOffset) + _length >= MS_SD_BLOCK_SIZE;
+}
+
+
+bool SDWriteBuffer::isTooOld(uint32_t now) {
+    return _length > 0 && now - _oldestRecordTime >= _maxAge_s;
+}
+
+
+// Only the part of the buffer up to the last block boundary of the file is
+// written when asked for whole blocks; the rest moves to the front
+bool SDWriteBuffer::writeTo(Print* file, uint32_t position,
+                            bool wholeBlocksOnly) {
+    uint16_t offset  = position % MS_SD_BLOCK_SIZE;
+    uint16_t toWrite = _length;
+    if (wholeBlocksOnly) {
+        uint32_t end = static_cast<uint32_t>(offset) + _length;
+        toWrite = end < MS_SD_BLOCK_SIZE
+            ? 0
+            : end - end % MS_SD_BLOCK_SIZE - offset;
+    }
+    uint16_t written = toWrite > 0 ? file->write(_buffer, toWrite) : 0;
+    MS_DBG(F("Wrote"), written, F("of"), _length, F("buffered bytes at"),
+           position);
+
+    memmove(_buffer, _buffer + written, _length - written);
+    _length -= written;
+    setPosition(position + written);
+    // What is left is the end of the last few records; it keeps the age of the
+    // oldest record written, which errs toward writing it out early
+    if (_length == 0) _oldestRecordTime = 0;
+    return written == toWrite;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file SDWriteBuffer.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the SDWriteBuffer class, for holding log records in RAM
+ * and writing them to the SD card in whole blocks.
+ */
+
+// Header Guards
+#ifndef SRC_SDWRITEBUFFER_H_
+#define SRC_SDWRITEBUFFER_H_
+
+// Debugging Statement
+// #define MS_SDWRITEBUFFER_DEBUG
+
+#ifdef MS_SDWRITEBUFFER_DEBUG
+#define MS_DEBUGGING_STD "SDWriteBuffer"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+/**
+ * @brief The size of a block of the SD card, in bytes.
+ */
+#define MS_SD_BLOCK_SIZE 512
+
+/**
+ * @brief The longest time, in seconds, a record is held in the buffer before
+ * it is written to the card even if no block is full yet.
+ */
+#ifndef MS_SD_BUFFER_MAX_AGE
+#define MS_SD_BUFFER_MAX_AGE 3600
+#endif
+
+/**
+ * @brief Holds log records in RAM until a whole block of the SD card can be
+ * written at once.
+ *
+ * The card reads, changes, and writes back a whole 512-byte block for even a
+ * short write, so writing each record as it is made wears the card and needs
+ * the card powered every logging interval.  Records printed into this buffer
+ * stay in RAM until they reach the end of the block the file ends in, or until
+ * the oldest of them has waited about the maximum age.  Only whole blocks are
+ * then written, so each write ends on a block boundary of the file; the rest
+ * waits for the next records.
+ *
+ * The buffer is supplied by the program and is never allocated.  It should
+ * hold at least one block and a record; 1024 bytes is a good size.  Anything
+ * still in the buffer is lost if the board resets.
+ */
+class SDWriteBuffer : public Print {
+ public:
+    /**
+     * @brief Construct a new SDWriteBuffer object.
+     *
+     * @param buffer An array for the records; it is not copied, so it must
+     * outlive the write buffer.
+     * @param bufferSize The size of the array, in bytes.
+     * @param maxAge_s The longest time, in seconds, a record is held before
+     * it is written; optional with the default value of
+     * #MS_SD_BUFFER_MAX_AGE.
+     */
+    SDWriteBuffer(uint8_t* buffer, uint16_t bufferSize,
+                  uint32_t maxAge_s = MS_SD_BUFFER_MAX_AGE);
+    /**
+     * @brief Destroy the SDWriteBuffer object - no action taken.
+     */
+    ~SDWriteBuffer();
+
+    /**
+     * @brief Add a character to the record being printed.
+     *
+     * Once the buffer is full the rest of the record is only counted, and
+     * endRecord() takes the whole record back out.
+     *
+     * @param c The character.
+     * @return **size_t** Always 1, so printing carries on to the end of the
+     * record.
+     */
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    /**
+     * @brief Mark the start of a record.
+     *
+     * @param recordTime The time of the record, in seconds since the epoch.
+     */
+    void beginRecord(uint32_t recordTime);
+    /**
+     * @brief Mark the end of a record.
+     *
+     * @return **bool** True if the whole record fit in the buffer; if not,
+     * none of it is kept.
+     */
+    bool endRecord(void);
+    /**
+     * @brief Get the length of the last record, whether or not it fit.
+     *
+     * @return **uint16_t** The length, in bytes.
+     */
+    uint16_t getRecordLength(void);
+    /**
+     * @brief Get the space left in the buffer.
+     *
+     * @return **uint16_t** The free space, in bytes.
+     */
+    uint16_t getFree(void);
+    /**
+     * @brief Check whether the buffer holds anything.
+     *
+     * @return **bool** True if nothing is waiting to be written.
+     */
+    bool isEmpty(void);
+    /**
+     * @brief Set the position of the end of the file the records will be
+     * written to, which gives the place within a block the buffer starts at.
+     *
+     * @param position The size of the file, in bytes.
+     */
+    void setPosition(uint32_t position);
+    /**
+     * @brief Check whether the position of the end of the file has been set,
+     * by setPosition() or by a write.
+     *
+     * @return **bool** True if the place within a block is known.
+     */
+    bool hasPosition(void);
+    /**
+     * @brief Check whether the buffer reaches the end of the block the file
+     * ended in after the last write.
+     *
+     * @return **bool** True if at least one whole block can be written.
+     */
+    bool hasFullBlock(void);
+    /**
+     * @brief Check whether the oldest record in the buffer has been held for
+     * longer than the maximum age.
+     *
+     * @param now The current time, in seconds since the epoch.
+     * @return **bool** True if the buffer should be written out now.
+     */
+    bool isTooOld(uint32_t now);
+
+    /**
+     * @brief Write the buffered records to the end of a file.
+     *
+     * @param file The file to write to, already open at the end of its data.
+     * @param position The position of the write in the file, which gives its
+     * place within a block.
+     * @param wholeBlocksOnly True to write only up to the last block boundary
+     * and keep the rest; false to write everything.
+     * @return **bool** True if everything meant to be written was written.
+     * Anything that wasn't stays in the buffer.
+     */
+    bool writeTo(Print* file, uint32_t position, bool wholeBlocksOnly);
+
+ private:
+    uint8_t* _buffer;
+    uint16_t _bufferSize;
+    uint32_t _maxAge_s;
+    uint16_t _length;
+    uint16_t _recordStart;
+    uint16_t _recordLength;
+    uint16_t _blockOffset;
+    bool     _positionKnown;
+    uint32_t _oldestRecordTime;
+    uint32_t _recordTime;
+};
+
+#endif  // SRC_SDWRITEBUFFER_H_
@@ -9,6 +9,8 @@
 
 #include "SensorBase.h"
 #include "VariableBase.h"
+#include "sensors/SensorStatistics.h"
+#include "sensors/SensorPhaseTiming.h"
 
 // ============================================================================
 //  The class and functions for interfacing with a sensor
@@ -19,10 +21,40 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
                uint32_t warmUpTime_ms, uint32_t stabilizationTime_ms,
                uint32_t measurementTime_ms, int8_t powerPin, int8_t dataPin,
                uint8_t measurementsToAverage)
-    : _sensorName(sensorName), _numReturnedValues(numReturnedVars) {
+    : _sensorName(sensorName),
+      _numReturnedValues(numReturnedVars < MAX_NUMBER_VARS ? numReturnedVars
+                                                           : MAX_NUMBER_VARS) {
     _powerPin              = powerPin;
+    _powerPinHandle.attach(powerPin);
     _dataPin               = dataPin;
     _measurementsToAverage = measurementsToAverage;
+    _samplingInterval      = 1;
+    _valuesStale           = false;
+
+    // No non-blocking update has been started
+    _updateInProgress       = false;
+    _updateWasOn            = false;
+    _updateWasActive        = false;
+    _updateMeasurementsDone = 0;
+
+    // Statistics are only kept if a SensorStatistics object is attached
+    _statistics = NULL;
+
+    // Only ADC sensors set a calibration for raw readings
+    _rawSum              = 0;
+    _rawCount            = 0;
+    _rawCalibration      = NULL;
+    _rawCalibrationCount = 0;
+    _burstSampler        = NULL;
+
+    // The name and location are put together when first needed, since the
+    // location is virtual
+    _nameAndLocation[0] = '\0';
+
+    // Sub-classes that talk over a shared bus will set this in their own
+    // constructors
+    _busType = SENSOR_BUS_NONE;
+    _busId   = 0;
 
     // This is the time needed from the when a sensor has power until it's ready
     // to talk The _millisPowerOn value is set in the powerUp() function.  It is
@@ -30,6 +62,11 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
     // The "waitForWarmUp()" function verifies that enough time has passed.
     _warmUpTime_ms = warmUpTime_ms;
     _millisPowerOn = 0;
+    // Learning the warm-up time is opt-in; until something is learned the
+    // datasheet time is used.
+    _adaptiveWarmUp       = false;
+    _readinessRecorded    = false;
+    _learnedWarmUpTime_ms = warmUpTime_ms;
 
     // This is the time needed from the when a sensor is activated until the
     // readings are stable.  The _millisSensorActivated value is *usually* set
@@ -60,6 +97,15 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
     // Reset the sensor status
     _sensorStatus = 0;
 
+#ifdef MS_CHECK_SENSOR_TIMING
+    // Clear the timing profile
+    for (uint8_t p = 0; p < SENSOR_PHASE_COUNT; p++) {
+        _phaseHistoryCount[p] = 0;
+        _phaseHistoryNext[p]  = 0;
+    }
+    _phaseTiming = NULL;
+#endif
+
     // MS_DBG(F("Sensor object created"));
 }
 // Destructor
@@ -80,9 +126,14 @@ String Sensor::getSensorName(void) {
 }
 
 
-// This concatentates and returns the name and location.
-String Sensor::getSensorNameAndLocation(void) {
-    return getSensorName() + " at " + getSensorLocation();
+// This returns the name and location, putting them together the first time
+const char* Sensor::getSensorNameAndLocation(void) {
+    if (_nameAndLocation[0] == '\0') updateNameAndLocation();
+    return _nameAndLocation;
+}
+void Sensor::updateNameAndLocation(void) {
+    String nameAndLocation = getSensorName() + " at " + getSensorLocation();
+    nameAndLocation.toCharArray(_nameAndLocation, sizeof(_nameAndLocation));
 }
 
 
@@ -102,6 +153,127 @@ uint8_t Sensor::getNumberMeasurementsToAverage(void) {
 }
 
 
+// This is the longest a sensor should need to get through any one phase of an
+// update, with a margin for slow communication
+uint32_t Sensor::getPhaseTimeout(void) {
+    uint32_t longest = max(_warmUpTime_ms, _stabilizationTime_ms);
+    longest          = max(longest, _measurementTime_ms);
+    return longest + MS_SENSOR_TIMEOUT_MARGIN_MS;
+}
+
+
+// This gives up on the current update - any measurements already taken are
+// discarded and the error bit is set
+void Sensor::abortUpdate(void) {
+    MS_DBG(F("Giving up on the update of"), getSensorNameAndLocation());
+    clearValues();
+    // Unset the time stamp for the beginning of a measurement
+    _millisMeasurementRequested = 0;
+    // Unset the status bits for a measurement request (bits 5 & 6) and set
+    // the error bit (bit 7)
+    _sensorStatus &= 0b10011111;
+    _sensorStatus |= 0b10000000;
+}
+
+
+// This learns the warm-up time from the first answer after power on.  An
+// answer on the first try only shows the sensor was ready by then, so the
+// learned time is shortened a little to probe for a shorter one; needing
+// retries shows about when it was really ready; no answer at all falls back
+// to the datasheet time.
+void Sensor::recordReadiness(uint8_t attempts) {
+    if (!_adaptiveWarmUp || _readinessRecorded || _millisPowerOn == 0) return;
+    _readinessRecorded = true;
+
+    uint32_t elapsed = millis() - _millisPowerOn;
+    if (attempts == 0) {
+        _learnedWarmUpTime_ms = _warmUpTime_ms;
+    } else if (attempts == 1) {
+        // A first answer long after the warm-up (ie, after waiting for a shared
+        // bus) says nothing about how soon the sensor was ready
+        uint32_t late_ms = getWarmUpTime() +
+            _learnedWarmUpTime_ms * MS_WARM_UP_LEARNING_MARGIN / 100;
+        if (elapsed > late_ms) return;
+        _learnedWarmUpTime_ms -= _learnedWarmUpTime_ms /
+            MS_WARM_UP_LEARNING_STEP;
+    } else {
+        _learnedWarmUpTime_ms = min(elapsed, _warmUpTime_ms);
+    }
+    MS_DBG(getSensorNameAndLocation(), F("answered after"), elapsed,
+           F("ms and"), attempts, F("tries; its learned warm-up time is now"),
+           _learnedWarmUpTime_ms, F("ms"));
+}
+
+
+// These set and get the sampling interval, in logging intervals
+void Sensor::setSamplingInterval(uint8_t loggingIntervals) {
+    // A sampling interval of 0 makes no sense, treat it as "every time"
+    _samplingInterval = max(loggingIntervals, static_cast<uint8_t>(1));
+}
+uint8_t Sensor::getSamplingInterval(void) {
+    return _samplingInterval;
+}
+// The sensor is due on every cycle that is a multiple of its interval
+bool Sensor::isSamplingDue(uint32_t updateCycle) {
+    return updateCycle % _samplingInterval == 0;
+}
+// These set and get the burst taken for each measurement
+void Sensor::setBurstSampler(BurstSampler* burstSampler) {
+    _burstSampler = burstSampler;
+}
+BurstSampler* Sensor::getBurstSampler(void) {
+    return _burstSampler;
+}
+// These set and get the flag for values carried forward from an older update
+void Sensor::markValuesStale(void) {
+    _valuesStale = true;
+}
+bool Sensor::areValuesStale(void) {
+    return _valuesStale;
+}
+
+
+// These set and get the shared bus the sensor is attached to
+void Sensor::setBus(sensorBusType busType, uintptr_t busId) {
+    _busType = busType;
+    _busId   = busId;
+}
+void Sensor::setBus(sensorBusType busType, const void* bus) {
+    setBus(busType, reinterpret_cast<uintptr_t>(bus));
+}
+sensorBusType Sensor::getBusType(void) {
+    return _busType;
+}
+uintptr_t Sensor::getBusId(void) {
+    return _busId;
+}
+
+
+// These turn the adaptive warm-up on and off and get and set the learned time
+void Sensor::setAdaptiveWarmUp(bool enable) {
+    _adaptiveWarmUp = enable;
+}
+bool Sensor::isAdaptiveWarmUp(void) {
+    return _adaptiveWarmUp;
+}
+uint32_t Sensor::getLearnedWarmUpTime(void) {
+    return _learnedWarmUpTime_ms;
+}
+void Sensor::setLearnedWarmUpTime(uint32_t learnedTime_ms) {
+    _learnedWarmUpTime_ms = min(learnedTime_ms, _warmUpTime_ms);
+}
+
+
+// This returns the warm-up time to wait for - the learned time with a margin,
+// never longer than the datasheet time given in the constructor
+uint32_t Sensor::getWarmUpTime(void) {
+    if (!_adaptiveWarmUp) return _warmUpTime_ms;
+    uint32_t adapted = _learnedWarmUpTime_ms +
+        _learnedWarmUpTime_ms * MS_WARM_UP_LEARNING_MARGIN / 100;
+    return min(adapted, _warmUpTime_ms);
+}
+
+
 // This returns the 8-bit code for the current status of the sensor.
 // Bit 0 - 0=Has NOT been set up, 1=Has been setup
 // Bit 1 - 0=No attempt made to power sensor, 1=Attempt made to power sensor
@@ -124,9 +296,8 @@ void Sensor::powerUp(void) {
                _powerPin);
         // Set the pin mode, just in case
         pinMode(_powerPin, OUTPUT);
-        digitalWrite(_powerPin, HIGH);
-        // Mark the time that the sensor was powered
-        _millisPowerOn = millis();
+        _powerPinHandle.write(HIGH);
+        markPoweredOn();
     } else {
         MS_DBG(F("Power to"), getSensorNameAndLocation(),
                F("is not controlled by this library."));
@@ -138,12 +309,20 @@ void Sensor::powerUp(void) {
 }
 
 
+// This marks the time that the sensor was powered; the next answer is the
+// first of a new power cycle
+void Sensor::markPoweredOn(void) {
+    _millisPowerOn     = millis();
+    _readinessRecorded = false;
+}
+
+
 // This turns off sensor power
 void Sensor::powerDown(void) {
     if (_powerPin >= 0) {
         MS_DBG(F("Turning off power to"), getSensorNameAndLocation(),
                F("with pin"), _powerPin);
-        digitalWrite(_powerPin, LOW);
+        _powerPinHandle.write(LOW);
         // Unset the power-on time
         _millisPowerOn = 0;
         // Unset the activation time
@@ -176,6 +355,9 @@ bool Sensor::setup(void) {
     MS_DBG(_measurementsToAverage,
            F("individual measurements will be averaged for each reading."));
 
+    // The location may change during set up, so put it together again later
+    _nameAndLocation[0] = '\0';
+
     if (_powerPin >= 0) pinMode(_powerPin, OUTPUT);  // NOTE:  Not setting value
     if (_dataPin >= 0)
         pinMode(_dataPin, INPUT);  // NOTE:  Not turning on pull-up!
@@ -275,6 +457,7 @@ bool Sensor::startSingleMeasurement(void) {
 
 
 void Sensor::registerVariable(int sensorVarNum, Variable* var) {
+    if (sensorVarNum < 0 || sensorVarNum >= MAX_NUMBER_VARS) return;
     variables[sensorVarNum] = var;
     /*MS_DBG(F("... Registration from"), getSensorNameAndLocation(), F("for"),
            var->getVarName(), F("accepted."));*/
@@ -323,6 +506,14 @@ void Sensor::clearValues(void) {
         sensorValues[i]               = -9999;
         numberGoodMeasurementsMade[i] = 0;
     }
+    for (SensorStatistics* stats = _statistics; stats != NULL;
+         stats = stats->nextStatistics) {
+        stats->resetStatistics();
+    }
+    _rawSum      = 0;
+    _rawCount    = 0;
+    _valuesStale = false;
+    _sensorStatus &= 0b01111111;
 }
 
 
@@ -330,6 +521,15 @@ void Sensor::clearValues(void) {
 // averaged
 void Sensor::verifyAndAddMeasurementResult(uint8_t resultNumber,
                                            float   resultValue) {
+    // Ignore results beyond what the arrays can hold
+    if (resultNumber >= MAX_NUMBER_VARS) return;
+    // Every good result goes into any attached statistics
+    if (resultValue != -9999) {
+        for (SensorStatistics* stats = _statistics; stats != NULL;
+             stats = stats->nextStatistics) {
+            stats->addSample(resultNumber, resultValue);
+        }
+    }
     // If the new result is good and there was were only bad results, set the
     // result value as the new result and add 1 to the good result total
     if (sensorValues[resultNumber] == -9999 && resultValue != -9999) {
@@ -339,12 +539,14 @@ void Sensor::verifyAndAddMeasurementResult(uint8_t resultNumber,
         numberGoodMeasurementsMade[resultNumber] += 1;
     } else if (sensorValues[resultNumber] != -9999 && resultValue != -9999) {
         // If the new result is good and there were already good results in
-        // place add the new results to the total and add 1 to the good result
-        // total
+        // place add 1 to the good result total and move the running mean
+        // toward the new result
         MS_DBG(F("Adding"), resultValue, F("to result array for variable"),
                resultNumber, F("from"), getSensorNameAndLocation());
-        sensorValues[resultNumber] += resultValue;
         numberGoodMeasurementsMade[resultNumber] += 1;
+        sensorValues[resultNumber] +=
+            (resultValue - sensorValues[resultNumber]) /
+            numberGoodMeasurementsMade[resultNumber];
     } else if (sensorValues[resultNumber] == -9999 && resultValue == -9999) {
         // If the new result is bad and there were only bad results, do nothing
         MS_DBG(F("Ignoring bad result for variable"), resultNumber, F("from"),
@@ -364,65 +566,192 @@ void Sensor::verifyAndAddMeasurementResult(uint8_t resultNumber,
 }
 
 
+// This adds a raw reading to the integer sum
+void Sensor::addRawMeasurementResult(int16_t rawCount) {
+    MS_DBG(F("Adding raw reading"), rawCount, F("from"),
+           getSensorNameAndLocation());
+    _rawSum += rawCount;
+    _rawCount++;
+    // Statistics need every reading as a result, so only convert each one if
+    // there is somewhere for it to go
+    if (_statistics == NULL) return;
+    for (uint8_t c = 0; c < _rawCalibrationCount; c++) {
+        float resultValue = _rawCalibration[c].slope * rawCount +
+            _rawCalibration[c].offset;
+        for (SensorStatistics* stats = _statistics; stats != NULL;
+             stats = stats->nextStatistics) {
+            stats->addSample(_rawCalibration[c].resultNumber, resultValue);
+        }
+    }
+}
+// A reduced reading is converted right away and averaged like any other result
+void Sensor::addReducedRawResult(float rawCount) {
+    for (uint8_t c = 0; c < _rawCalibrationCount; c++) {
+        float resultValue = -9999;
+        if (rawCount != -9999) {
+            resultValue = _rawCalibration[c].slope * rawCount +
+                _rawCalibration[c].offset;
+        }
+        verifyAndAddMeasurementResult(_rawCalibration[c].resultNumber,
+                                      resultValue);
+    }
+}
+void Sensor::setRawCalibration(const rawResultCalibration* calibration,
+                               uint8_t                     calibrationCount) {
+    _rawCalibration      = calibration;
+    _rawCalibrationCount = calibrationCount;
+}
+
+
 void Sensor::averageMeasurements(void) {
     MS_DBG(F("Averaging results from"), getSensorNameAndLocation(), F("over"),
            _measurementsToAverage, F("reading[s]"));
+    // Convert the mean of any raw readings into results, once
+    if (_rawCount > 0) {
+        float rawMean = static_cast<float>(_rawSum) / _rawCount;
+        MS_DBG(F("  Mean raw reading:"), rawMean, F("from"), _rawCount);
+        for (uint8_t c = 0; c < _rawCalibrationCount; c++) {
+            uint8_t r = _rawCalibration[c].resultNumber;
+            if (r >= _numReturnedValues) continue;
+            sensorValues[r] = _rawCalibration[c].slope * rawMean +
+                _rawCalibration[c].offset;
+            numberGoodMeasurementsMade[r] = _rawCount;
+        }
+    }
+    // The values array already holds the running mean of the good results
     for (uint8_t i = 0; i < _numReturnedValues; i++) {
-        if (numberGoodMeasurementsMade[i] > 0)
-            sensorValues[i] /= numberGoodMeasurementsMade[i];
-        MS_DBG(F("    ->Result #"), i, ':', sensorValues[i]);
+        MS_DBG(F("    ->Result #"), i, ':', sensorValues[i], F("from"),
+               numberGoodMeasurementsMade[i], F("good reading[s]"));
+    }
+    for (SensorStatistics* stats = _statistics; stats != NULL;
+         stats = stats->nextStatistics) {
+        stats->publishStatistics();
     }
+#ifdef MS_CHECK_SENSOR_TIMING
+    // Every phase of this update has been recorded by now
+    for (SensorPhaseTiming* timing = _phaseTiming; timing != NULL;
+         timing = timing->nextPhaseTiming) {
+        timing->publishTiming();
+    }
+#endif
+}
+
+
+// This adds a statistics object to the end of the list
+void Sensor::attachStatistics(SensorStatistics* statistics) {
+    statistics->nextStatistics = NULL;
+    if (_statistics == NULL) {
+        _statistics = statistics;
+        return;
+    }
+    SensorStatistics* last = _statistics;
+    while (last->nextStatistics != NULL) last = last->nextStatistics;
+    last->nextStatistics = statistics;
+}
+// This adds a phase timing object to the end of the list
+void Sensor::attachPhaseTiming(SensorPhaseTiming* phaseTiming) {
+#ifdef MS_CHECK_SENSOR_TIMING
+    phaseTiming->nextPhaseTiming = NULL;
+    if (_phaseTiming == NULL) {
+        _phaseTiming = phaseTiming;
+        return;
+    }
+    SensorPhaseTiming* last = _phaseTiming;
+    while (last->nextPhaseTiming != NULL) last = last->nextPhaseTiming;
+    last->nextPhaseTiming = phaseTiming;
+#else
+    (void)phaseTiming;
+#endif
 }
 
 
 // This updates a sensor value by checking it's power, waking it, taking as many
 // readings as requested, then putting the sensor to sleep and powering down.
 bool Sensor::update(void) {
-    bool ret_val = true;
+    // Continue any update that was already started
+    if (!_updateInProgress) beginUpdate();
+
+    sensorUpdateState state;
+    do {
+        state = pollUpdate();
+    } while (state == SENSOR_UPDATE_IN_PROGRESS);
+
+    return state == SENSOR_UPDATE_DONE;
+}
+
+
+// This starts a non-blocking update
+bool Sensor::beginUpdate(void) {
+    if (_updateInProgress) return false;
 
     // Check if the power is on, turn it on if not
-    bool wasOn = checkPowerOn();
-    if (!wasOn) { powerUp(); }
+    _updateWasOn = checkPowerOn();
+    if (!_updateWasOn) { powerUp(); }
 
-    // Check if it's awake/active, activate it if not
-    bool wasActive = bitRead(getStatus(), 3);
-    if (!wasActive) {
-        // NOT yet awake
-        // wait for the sensor to have been powered for long enough to respond
-        waitForWarmUp();
-        ret_val &= wake();
-    }
-    // bail if the wake failed
-    if (!ret_val) return ret_val;
+    // Check if it's awake/active; if not it will be woken once it's warmed up
+    _updateWasActive = bitRead(_sensorStatus, 3);
 
-    // Clear values before starting loop
+    // Clear values before starting
     clearValues();
+    _updateMeasurementsDone = 0;
+    _updateInProgress       = true;
+    return true;
+}
+
 
-    // Wait for the sensor to stabilize
-    waitForStability();
+// This does whichever steps of the update are ready to be done, following the
+// same status bits as VariableArray::completeUpdate()
+sensorUpdateState Sensor::pollUpdate(void) {
+    if (!_updateInProgress) return SENSOR_UPDATE_DONE;
+
+    // If no attempt has been made to wake the sensor, wait for it to warm up
+    if (!bitRead(_sensorStatus, 3)) {
+        if (!isWarmedUp()) return SENSOR_UPDATE_IN_PROGRESS;
+        wake();
+    }
+    // bail if the wake failed
+    if (!bitRead(_sensorStatus, 4)) {
+        return finishUpdate(SENSOR_UPDATE_FAILED);
+    }
 
-    // loop through as many measurements as requested
-    for (uint8_t j = 0; j < _measurementsToAverage; j++) {
-        // start a measurement
-        ret_val += startSingleMeasurement();
-        // wait for the measurement to finish
-        waitForMeasurementCompletion();
-        // get the measurement result
-        ret_val += addSingleMeasurementResult();
+    // loop through as many measurements as requested, as long as each step is
+    // ready
+    while (_updateMeasurementsDone < _measurementsToAverage) {
+        // start a measurement once the sensor is stable
+        if (!bitRead(_sensorStatus, 5)) {
+            if (!isStable()) return SENSOR_UPDATE_IN_PROGRESS;
+            startSingleMeasurement();
+        }
+        // get the measurement result once it's finished; this also fills in
+        // the -9999 results for a measurement that failed to start
+        if (!isMeasurementComplete()) return SENSOR_UPDATE_IN_PROGRESS;
+        addSingleMeasurementResult();
+        _updateMeasurementsDone++;
     }
 
     averageMeasurements();
+    return finishUpdate(SENSOR_UPDATE_DONE);
+}
 
-    // Put the sensor back to sleep if it had been activated
-    if (wasActive) { sleep(); }
+
+// This puts the sensor back the way it was before the update
+sensorUpdateState Sensor::finishUpdate(sensorUpdateState state) {
+    // Put the sensor back to sleep if it was woken for the update
+    if (!_updateWasActive) { sleep(); }
 
     // Turn the power back off it it had been turned on
-    if (!wasOn) { powerDown(); }
+    if (!_updateWasOn) { powerDown(); }
 
     // Update the registered variables with the new values
     notifyVariables();
 
-    return ret_val;
+    _updateInProgress = false;
+    return state;
+}
+
+
+bool Sensor::isUpdating(void) {
+    return _updateInProgress;
 }
 
 
@@ -433,10 +762,7 @@ bool Sensor::checkPowerOn(bool debug) {
                getSensorNameAndLocation());
     }
     if (_powerPin >= 0) {
-        int8_t powerBitNumber = log(digitalPinToBitMask(_powerPin)) / log(2);
-
-        if (bitRead(*portInputRegister(digitalPinToPort(_powerPin)),
-                    powerBitNumber) == LOW) {
+        if (_powerPinHandle.read() == LOW) {
             if (debug) { MS_DBG(F("was off.")); }
             // Reset time of power on, in-case it was set to a value
             _millisPowerOn = 0;
@@ -479,7 +805,7 @@ bool Sensor::isWarmedUp(bool debug) {
 
     uint32_t elapsed_since_power_on = millis() - _millisPowerOn;
     // If the sensor has power and enough time has elapsed, it's warmed up
-    if (elapsed_since_power_on > _warmUpTime_ms) {
+    if (elapsed_since_power_on > getWarmUpTime()) {
         if (debug) {
             MS_DBG(F("It's been"), (elapsed_since_power_on), F("ms, and"),
                    getSensorNameAndLocation(), F("should be warmed up!"));
@@ -572,3 +898,114 @@ bool Sensor::isMeasurementComplete(bool debug) {
 void Sensor::waitForMeasurementCompletion(void) {
     while (!isMeasurementComplete()) {}
 }
+
+
+// This calculates the time remaining until the sensor is ready for its next
+// step.  This must match the timing checks in isWarmedUp(), isStable(), and
+// isMeasurementComplete(), which are true once the elapsed time is *greater*
+// than the specified time.
+uint32_t Sensor::getTimeUntilReady(void) {
+    uint32_t elapsed;
+    uint32_t target;
+    if (bitRead(_sensorStatus, 6)) {
+        // A measurement was successfully started, waiting for completion
+        elapsed = millis() - _millisMeasurementRequested;
+        target  = _measurementTime_ms;
+    } else if (bitRead(_sensorStatus, 4) && !bitRead(_sensorStatus, 5)) {
+        // Awake, but no measurement requested yet, waiting for stability
+        elapsed = millis() - _millisSensorActivated;
+        target  = _stabilizationTime_ms;
+    } else if (bitRead(_sensorStatus, 2) && !bitRead(_sensorStatus, 3)) {
+        // Powered, but no wake attempt made yet, waiting for warm-up
+        elapsed = millis() - _millisPowerOn;
+        target  = getWarmUpTime();
+    } else {
+        return 0;
+    }
+    if (elapsed > target) { return 0; }
+    return target - elapsed + 1;
+}
+
+
+// This returns the total expected time for the sensor to power up, wake,
+// stabilize, and take all of the measurements to average.
+uint32_t Sensor::getExpectedUpdateTime(void) {
+    uint32_t measurementTime_ms = _measurementTime_ms;
+    if (_burstSampler != NULL) {
+        measurementTime_ms += _burstSampler->getBurstTime_ms();
+    }
+    return getWarmUpTime() + _stabilizationTime_ms +
+        static_cast<uint32_t>(_measurementsToAverage) * measurementTime_ms;
+}
+
+
+// This adds a phase duration to the timing profile ring buffer, overwriting the
+// oldest entry once the buffer is full
+void Sensor::recordPhaseTime(sensorPhase phase, uint32_t duration_ms) {
+#ifdef MS_CHECK_SENSOR_TIMING
+    _phaseHistory[phase][_phaseHistoryNext[phase]] = duration_ms;
+    _phaseHistoryNext[phase] =
+        (_phaseHistoryNext[phase] + 1) % MS_SENSOR_TIMING_HISTORY;
+    if (_phaseHistoryCount[phase] < MS_SENSOR_TIMING_HISTORY) {
+        _phaseHistoryCount[phase]++;
+    }
+#else
+    (void)phase;
+    (void)duration_ms;
+#endif
+}
+
+
+// These return the statistics of the durations kept in the timing profile.
+// Only the filled part of the buffer is used, so the order doesn't matter.
+uint8_t Sensor::getPhaseCount(sensorPhase phase) {
+#ifdef MS_CHECK_SENSOR_TIMING
+    return _phaseHistoryCount[phase];
+#else
+    (void)phase;
+    return 0;
+#endif
+}
+float Sensor::getPhaseMin(sensorPhase phase) {
+    if (getPhaseCount(phase) == 0) return -9999;
+    uint32_t result = 0xFFFFFFFF;
+#ifdef MS_CHECK_SENSOR_TIMING
+    for (uint8_t i = 0; i < _phaseHistoryCount[phase]; i++) {
+        result = min(result, _phaseHistory[phase][i]);
+    }
+#endif
+    return static_cast<float>(result);
+}
+float Sensor::getPhaseMean(sensorPhase phase) {
+    if (getPhaseCount(phase) == 0) return -9999;
+    float total = 0;
+#ifdef MS_CHECK_SENSOR_TIMING
+    for (uint8_t i = 0; i < _phaseHistoryCount[phase]; i++) {
+        total += _phaseHistory[phase][i];
+    }
+#endif
+    return total / getPhaseCount(phase);
+}
+float Sensor::getPhaseMax(sensorPhase phase) {
+    if (getPhaseCount(phase) == 0) return -9999;
+    uint32_t result = 0;
+#ifdef MS_CHECK_SENSOR_TIMING
+    for (uint8_t i = 0; i < _phaseHistoryCount[phase]; i++) {
+        result = max(result, _phaseHistory[phase][i]);
+    }
+#endif
+    return static_cast<float>(result);
+}
+
+
+// This returns a short name for each phase of an update
+String Sensor::getPhaseName(sensorPhase phase) {
+    switch (phase) {
+        case SENSOR_PHASE_WARM_UP: return F("warmUp");
+        case SENSOR_PHASE_WAKE: return F("wake");
+        case SENSOR_PHASE_STABILIZATION: return F("stabilization");
+        case SENSOR_PHASE_MEASUREMENT: return F("measurement");
+        case SENSOR_PHASE_RESULT: return F("result");
+        default: return F("unknown");
+    }
+}
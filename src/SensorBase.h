@@ -34,14 +34,133 @@
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
 #include <pins_arduino.h>
+#include "PinHandle.h"
+#include "BurstSampler.h"
 
 /**
  * @brief The largest number of variables from a single sensor
+ *
+ * Every sensor object keeps a value, a good-measurement count, and a variable
+ * pointer for this many results, however few it returns.  These are not sized
+ * per sensor; lowering this with a build flag saves RAM on every sensor when
+ * no sensor in use returns more than a few values.
+ * Results from a sensor beyond this number are ignored.
  */
+#ifndef MAX_NUMBER_VARS
 #define MAX_NUMBER_VARS 8
+#endif
+
+/**
+ * @brief The longest sensor name and location, with the " at " between them,
+ * kept by each sensor for getSensorNameAndLocation().
+ *
+ * Each sensor uses this many bytes of RAM plus one.  Longer names and locations
+ * are cut off.
+ */
+#ifndef MAX_NAME_LOCATION_LENGTH
+#define MAX_NAME_LOCATION_LENGTH 40
+#endif
+
+/**
+ * @brief The extra time, beyond the longest of its warm-up, stabilization,
+ * and measurement times, that a sensor may spend in one phase of an update
+ * before VariableArray::completeUpdate() gives up on it.
+ *
+ * Override this with a build flag if a sensor has slow blocking functions.
+ */
+#ifndef MS_SENSOR_TIMEOUT_MARGIN_MS
+#define MS_SENSOR_TIMEOUT_MARGIN_MS 10000L
+#endif
+
+/**
+ * @brief The extra time, as a percent of the learned warm-up time, that a
+ * sensor with an adaptive warm-up is given before it is woken.
+ */
+#ifndef MS_WARM_UP_LEARNING_MARGIN
+#define MS_WARM_UP_LEARNING_MARGIN 25
+#endif
 
+/**
+ * @brief How quickly an adaptive warm-up time is shortened.
+ *
+ * Each time a sensor with an adaptive warm-up answers on the first try, its
+ * learned warm-up time is shortened by 1/MS_WARM_UP_LEARNING_STEP.  A larger
+ * number probes for a shorter warm-up more slowly, so fewer updates need to
+ * retry the sensor.
+ */
+#ifndef MS_WARM_UP_LEARNING_STEP
+#define MS_WARM_UP_LEARNING_STEP 32
+#endif
 
-class Variable;  // Forward declaration
+#if defined(MS_CHECK_SENSOR_TIMING) || defined(DOXYGEN)
+#ifndef MS_SENSOR_TIMING_HISTORY
+/**
+ * @brief The number of past durations of each update phase kept by each sensor
+ * for the timing profile.
+ *
+ * The timing profile is only kept if MS_CHECK_SENSOR_TIMING is defined as a
+ * build flag.  Each sensor uses 4 bytes of RAM per phase for each entry.
+ */
+#define MS_SENSOR_TIMING_HISTORY 8
+#endif
+#endif
+
+
+class Variable;          // Forward declaration
+class SensorStatistics;  // Forward declaration
+class SensorPhaseTiming;  // Forward declaration
+
+/**
+ * @brief The kinds of shared communication bus a sensor may be attached to.
+ *
+ * Sensors on the same bus (the same kind *and* the same bus identity) must
+ * take turns talking, but sensors on different buses can be serviced in any
+ * order.
+ */
+typedef enum sensorBusType {
+    SENSOR_BUS_NONE = 0,      ///< No shared bus (ie, analog or internal)
+    SENSOR_BUS_SDI12,         ///< An SDI-12 data pin
+    SENSOR_BUS_MODBUS,        ///< An RS485/Modbus stream
+    SENSOR_BUS_SERIAL,        ///< Any other serial stream
+    SENSOR_BUS_I2C,           ///< A hardware TwoWire instance
+    SENSOR_BUS_SOFTWARE_I2C,  ///< A SoftwareWire instance
+    SENSOR_BUS_ONEWIRE        ///< A OneWire data pin
+} sensorBusType;
+
+/**
+ * @brief The phases of a sensor update, for the timing profile.
+ */
+typedef enum sensorPhase {
+    SENSOR_PHASE_WARM_UP = 0,     ///< From power on until the wake attempt
+    SENSOR_PHASE_WAKE,            ///< Running the wake() function
+    SENSOR_PHASE_STABILIZATION,   ///< From wake until the first measurement
+    SENSOR_PHASE_MEASUREMENT,     ///< From a measurement request until the
+                                  ///< result is requested
+    SENSOR_PHASE_RESULT,          ///< Running addSingleMeasurementResult()
+    SENSOR_PHASE_COUNT            ///< The number of phases
+} sensorPhase;
+
+/**
+ * @brief The state of a non-blocking sensor update; see Sensor::pollUpdate().
+ */
+typedef enum sensorUpdateState {
+    SENSOR_UPDATE_IN_PROGRESS = 0,  ///< Still waiting on the sensor
+    SENSOR_UPDATE_DONE,             ///< Finished, the values are ready
+    SENSOR_UPDATE_FAILED            ///< The sensor could not be woken
+} sensorUpdateState;
+
+/**
+ * @brief The conversion of the mean of the raw ADC counts of a sensor into one
+ * of its results; see Sensor::addRawMeasurementResult().
+ *
+ * The result is `slope * mean count + offset`.  Because the conversion is
+ * applied to the mean count rather than to each reading, it must be linear.
+ */
+typedef struct rawResultCalibration {
+    uint8_t resultNumber;  ///< The position of the result in the result array
+    float   slope;         ///< The result units per ADC count
+    float   offset;        ///< The result at an ADC count of 0
+} rawResultCalibration;
 
 /**
  * @brief The "Sensor" class is used for all sensor-level operations - waking,
@@ -129,12 +248,23 @@ class Sensor {
      */
     virtual String getSensorName(void);
     /**
-     * @brief Concatentate and returns the name and location of the sensor.
+     * @brief Get the name and location of the sensor.
+     *
+     * The name and location are put together once, the first time they're
+     * needed, and kept in a fixed buffer so no String is made on each call.
+     *
+     * @return **const char*** A concatenation of the sensor name and its
+     * "location" - how it is connected to the mcu.
+     */
+    const char* getSensorNameAndLocation(void);
+    /**
+     * @brief Put together the name and location of the sensor again.
      *
-     * @return **String** A concatenation of the sensor name and its "location"
-     * - how it is connected to the mcu.
+     * This must be called if the location changes after it was first used.
+     * VariableArray::setupSensors() calls it after setting up each sensor,
+     * since some sensors only learn their address during set up.
      */
-    String getSensorNameAndLocation(void);
+    void updateNameAndLocation(void);
     /**
      * @brief Get the pin number controlling sensor power.
      *
@@ -161,6 +291,154 @@ class Sensor {
      */
     uint8_t getNumberMeasurementsToAverage(void);
 
+    /**
+     * @brief Set how often the sensor should be sampled, as a multiple of
+     * the logging interval.
+     *
+     * A sensor with a sampling interval of 1 (the default) is updated every
+     * time the variable array is.  A sensor with a sampling interval of 12 on
+     * a logger with a 5 minute logging interval would only be powered and
+     * measured once an hour; in between its last values are carried forward
+     * and flagged as stale.
+     *
+     * @param loggingIntervals The number of logging intervals between samples.
+     */
+    void setSamplingInterval(uint8_t loggingIntervals);
+    /**
+     * @brief Get how often the sensor should be sampled, as a multiple of
+     * the logging interval.
+     *
+     * @return **uint8_t** The number of logging intervals between samples.
+     */
+    uint8_t getSamplingInterval(void);
+    /**
+     * @brief Check whether the sensor should be sampled in a given update
+     * cycle.
+     *
+     * @param updateCycle The number of the update (logging) cycle.
+     * @return **bool** True if the sensor is due to be sampled.
+     */
+    bool isSamplingDue(uint32_t updateCycle);
+
+    /**
+     * @brief Take each measurement as a burst of fast raw readings reduced to
+     * one value.
+     *
+     * Only sensors read through an ADC support bursts; others ignore this.
+     * The burst time is added to the measurement time in
+     * getExpectedUpdateTime().
+     *
+     * @param burstSampler The BurstSampler object, or NULL to take a single
+     * reading per measurement again.  It is not copied, so it must outlive
+     * the sensor.
+     */
+    void setBurstSampler(BurstSampler* burstSampler);
+    /**
+     * @brief Get the BurstSampler object used for each measurement.
+     *
+     * @return **BurstSampler\*** The BurstSampler object, or NULL if each
+     * measurement is a single reading.
+     */
+    BurstSampler* getBurstSampler(void);
+    /**
+     * @brief Flag the current values as stale - that is, carried forward from
+     * an earlier update because the sensor was not sampled.
+     *
+     * The flag is cleared when the values are cleared for a new update.
+     */
+    void markValuesStale(void);
+    /**
+     * @brief Check whether the current values are stale.
+     *
+     * @return **bool** True if the current values were carried forward from an
+     * earlier update.
+     */
+    bool areValuesStale(void);
+
+    /**
+     * @brief Set the shared communication bus the sensor is attached to.
+     *
+     * Sensor sub-classes set this in their constructors; it only needs to be
+     * called in a program to describe a bus the library doesn't know about.
+     *
+     * @param busType The kind of bus; see #sensorBusType.
+     * @param busId A value identifying the specific bus of that kind - ie, the
+     * data pin number for SDI-12 or the address of the Stream or TwoWire
+     * object.
+     */
+    void setBus(sensorBusType busType, uintptr_t busId);
+    /**
+     * @brief Set the shared communication bus the sensor is attached to.
+     *
+     * @param busType The kind of bus; see #sensorBusType.
+     * @param bus A pointer to the object controlling the bus - ie, the Stream
+     * or TwoWire object.  The address is used as the bus identity.
+     */
+    void setBus(sensorBusType busType, const void* bus);
+    /**
+     * @brief Get the kind of shared bus the sensor is attached to.
+     *
+     * @return **sensorBusType** The kind of bus.
+     */
+    sensorBusType getBusType(void);
+    /**
+     * @brief Get the identity of the shared bus the sensor is attached to.
+     *
+     * @return **uintptr_t** A value identifying the specific bus.
+     */
+    uintptr_t getBusId(void);
+
+    /**
+     * @brief Turn learning of the warm-up time on or off.
+     *
+     * Most sensors are given the longest warm-up time in their datasheet.
+     * With an adaptive warm-up, a sensor that can tell the logger when it is
+     * ready to talk - a Modbus reply, an SDI-12 acknowledgement, or an I2C
+     * acknowledgement from an Atlas circuit - keeps track of how long it
+     * actually takes to answer after it is powered and is woken that long (plus
+     * #MS_WARM_UP_LEARNING_MARGIN percent) after power on instead.  The
+     * learned time is slowly shortened while the sensor keeps answering on
+     * the first try and jumps back up as soon as it doesn't, so an occasional
+     * update may need a retry.  It is never longer than the warm-up time given
+     * in the constructor.
+     *
+     * This is off by default.  It only helps a sensor that has its power
+     * turned off between updates and that calls recordReadiness().  Use
+     * VariableArray::saveWarmUpTimes() and VariableArray::loadWarmUpTimes()
+     * to keep the learned times across resets.
+     *
+     * @param enable True to learn the warm-up time.
+     */
+    void setAdaptiveWarmUp(bool enable);
+    /**
+     * @brief Check whether the sensor is learning its warm-up time.
+     *
+     * @return **bool** True if the warm-up time is adaptive.
+     */
+    bool isAdaptiveWarmUp(void);
+    /**
+     * @brief Get the warm-up time currently in use.
+     *
+     * @return **uint32_t** The learned warm-up time plus its margin if the
+     * warm-up is adaptive, otherwise the warm-up time given in the
+     * constructor.
+     */
+    uint32_t getWarmUpTime(void);
+    /**
+     * @brief Get the learned time between power on and the sensor's first
+     * answer, without the margin.
+     *
+     * @return **uint32_t** The learned warm-up time in milliseconds.
+     */
+    uint32_t getLearnedWarmUpTime(void);
+    /**
+     * @brief Set the learned warm-up time, ie, one saved from an earlier run.
+     *
+     * @param learnedTime_ms The learned warm-up time in milliseconds.  It is
+     * limited to the warm-up time given in the constructor.
+     */
+    void setLearnedWarmUpTime(uint32_t learnedTime_ms);
+
     /**
      * @brief Get the 8-bit code for the current status of the sensor.
      *
@@ -240,10 +518,53 @@ class Sensor {
      * used.  To work with many sensors together, use the VariableArray class
      * which optimizes the timing and waits for many sensors working together.
      *
+     * This runs beginUpdate() and then pollUpdate() until the update is
+     * finished.  To do other work while waiting on the sensor, call those
+     * yourself instead.
+     *
      * @return **bool** True if all steps of the sensor update completed
      * successfully.
      */
     virtual bool update(void);
+    /**
+     * @brief Start an update of the sensor's values without waiting for it.
+     *
+     * This clears the values, powers the sensor if it isn't already powered,
+     * and notes whether the power and sensor were already on so they can be
+     * put back the same way.  The rest of the update is done by calling
+     * pollUpdate() until it's finished.
+     *
+     * @return **bool** True if an update was started; false if one is already
+     * in progress.
+     */
+    bool beginUpdate(void);
+    /**
+     * @brief Move an update started with beginUpdate() on as far as it can go
+     * without waiting.
+     *
+     * Each call wakes the sensor, starts a measurement, or gets a result if
+     * enough time has passed for that step, following the #_sensorStatus bits,
+     * and returns right away if it hasn't.  When all of the measurements are
+     * taken, it averages them, puts the sensor back to sleep and powers it
+     * down if the update woke and powered it, and notifies the attached
+     * variables.
+     *
+     * @note Don't use this on a sensor that is also being updated by a
+     * VariableArray at the same time.
+     *
+     * @return **sensorUpdateState** SENSOR_UPDATE_IN_PROGRESS until the update
+     * is finished, then SENSOR_UPDATE_DONE, or SENSOR_UPDATE_FAILED if the
+     * sensor did not wake.  If no update is in progress, this returns
+     * SENSOR_UPDATE_DONE.
+     */
+    sensorUpdateState pollUpdate(void);
+    /**
+     * @brief Check whether an update started with beginUpdate() is still in
+     * progress.
+     *
+     * @return **bool** True if the update isn't finished.
+     */
+    bool isUpdating(void);
 
     /**
      * @brief Turn on the sensor power, if applicable.
@@ -324,12 +645,18 @@ class Sensor {
 
     /**
      * @brief Clear the values array - that is, sets all values to -9999.
+     *
+     * This also clears the stale flag and the error bit (bit 7) of the
+     * #_sensorStatus.
      */
     void clearValues();
     /**
      * @brief Verify that a measurement is OK (ie, not -9999) before adding it
      * to the result array
      *
+     * The result array keeps the running mean of the good measurements, so no
+     * precision is lost to a large sum when many measurements are averaged.
+     *
      * @param resultNumber The position of the result within the result array.
      * @param resultValue The value of the result.
      */
@@ -344,10 +671,67 @@ class Sensor {
     void verifyAndAddMeasurementResult(uint8_t resultNumber,
                                        int16_t resultValue);
     /**
-     * @brief Average the results of all measurements by dividing the sum of
-     * all measurements by the number of measurements taken.
+     * @brief Add a good raw reading from an ADC to the integer sum of the
+     * readings for this update.
+     *
+     * No floating point math is done for the reading; the mean count is
+     * converted into each of the results set with setRawCalibration() once,
+     * by averageMeasurements().  Bad readings should not be added at all.
+     *
+     * @param rawCount The reading, in ADC counts.
+     */
+    void addRawMeasurementResult(int16_t rawCount);
+    /**
+     * @brief Add a raw value that is already reduced from many readings, like
+     * the result of a burst, as one measurement.
+     *
+     * The value isn't an integer, so it is converted into each of the results
+     * set with setRawCalibration() right away instead of being summed.
+     *
+     * @param rawCount The reduced value, in ADC counts, or -9999 if there is
+     * no good value.
+     */
+    void addReducedRawResult(float rawCount);
+    /**
+     * @brief Set how the mean of the raw readings added with
+     * addRawMeasurementResult() is converted into results.
+     *
+     * @param calibration An array of conversions, one for each result made
+     * from the raw readings; it is not copied, so it must outlive the sensor.
+     * @param calibrationCount The number of conversions in the array.
+     */
+    void setRawCalibration(const rawResultCalibration* calibration,
+                           uint8_t                     calibrationCount);
+    /**
+     * @brief Finish averaging the results of all measurements and hand the
+     * statistics of the measurements to any attached SensorStatistics and
+     * the timing profile to any attached SensorPhaseTiming.
+     *
+     * The values array already holds the running mean of the good
+     * measurements; see verifyAndAddMeasurementResult().  Results made from
+     * raw ADC readings are converted from the mean reading here; see
+     * addRawMeasurementResult().
      */
     void averageMeasurements(void);
+    /**
+     * @brief Attach a SensorStatistics object to keep the statistics of the
+     * measurements of one of the results of this sensor.
+     *
+     * This is called by the SensorStatistics constructor.
+     *
+     * @param statistics The SensorStatistics object.
+     */
+    void attachStatistics(SensorStatistics* statistics);
+    /**
+     * @brief Attach a SensorPhaseTiming object to report the timing profile of
+     * this sensor.
+     *
+     * This is called by the SensorPhaseTiming constructor.  It does nothing
+     * unless MS_CHECK_SENSOR_TIMING is defined as a build flag.
+     *
+     * @param phaseTiming The SensorPhaseTiming object.
+     */
+    void attachPhaseTiming(SensorPhaseTiming* phaseTiming);
 
     /**
      * @brief Register a variable object to a sensor.
@@ -429,8 +813,137 @@ class Sensor {
      */
     void waitForMeasurementCompletion(void);
 
+    /**
+     * @brief Get the time remaining until the sensor is ready for the next step
+     * of an update cycle.
+     *
+     * Depending on the #_sensorStatus, this is the time remaining before the
+     * sensor is warmed up (if it is powered, but no wake attempt has been
+     * made), stable (if it is awake, but no measurement has been requested), or
+     * finished measuring (if a measurement was successfully started).
+     *
+     * @return **uint32_t** The number of milliseconds until isWarmedUp(),
+     * isStable(), or isMeasurementComplete() will return true; 0 if it already
+     * will.
+     */
+    uint32_t getTimeUntilReady(void);
+    /**
+     * @brief Get the expected time needed for a complete update of this sensor.
+     *
+     * This is the sum of the warm-up time, the stabilization time, and the
+     * measurement time, with the time of any burst, multiplied by the number
+     * of measurements to average.
+     * It is the minimum time the sensor would need to be powered for a full
+     * update cycle if it did not wait on any other sensors.
+     *
+     * @return **uint32_t** The expected duration of an update in milliseconds.
+     */
+    uint32_t getExpectedUpdateTime(void);
+    /**
+     * @brief Get the longest time the sensor should take in any one phase of
+     * an update.
+     *
+     * This is the longest of the warm-up, stabilization, and measurement
+     * times plus #MS_SENSOR_TIMEOUT_MARGIN_MS.
+     *
+     * @return **uint32_t** The phase timeout in milliseconds.
+     */
+    uint32_t getPhaseTimeout(void);
+    /**
+     * @brief Give up on the current update of the sensor.
+     *
+     * This clears the values array to -9999, sets the error bit (bit 7) of the
+     * #_sensorStatus, and unsets the measurement request bits.  The sensor
+     * still needs to be put to sleep and powered down.
+     */
+    void abortUpdate(void);
+    /**
+     * @brief Record how the sensor answered the first time it was talked to
+     * after power on; used to learn an adaptive warm-up time.
+     *
+     * Sensor sub-classes that can tell when the sensor is ready call this
+     * with the number of tries it took to get the first valid answer after
+     * the sensor was powered, or 0 if it never answered.  Only the first call
+     * after each power on counts, and nothing is learned unless
+     * setAdaptiveWarmUp() has been turned on.
+     *
+     * @param attempts The number of tries before the sensor answered; 0 if it
+     * didn't answer at all.
+     */
+    void recordReadiness(uint8_t attempts);
+
+    /**
+     * @brief Add the duration of one phase of an update to the sensor's
+     * timing profile.
+     *
+     * The profile keeps the last #MS_SENSOR_TIMING_HISTORY durations of each
+     * phase.  This does nothing unless MS_CHECK_SENSOR_TIMING is defined as a
+     * build flag.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @param duration_ms The time spent in the phase in milliseconds.
+     */
+    void recordPhaseTime(sensorPhase phase, uint32_t duration_ms);
+    /**
+     * @brief Get the number of durations of a phase in the timing profile.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @return **uint8_t** The number of durations kept for the phase.
+     */
+    uint8_t getPhaseCount(sensorPhase phase);
+    /**
+     * @brief Get the shortest duration of a phase in the timing profile.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @return **float** The shortest duration in milliseconds; -9999 if there
+     * are none.
+     */
+    float getPhaseMin(sensorPhase phase);
+    /**
+     * @brief Get the mean duration of a phase in the timing profile.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @return **float** The mean duration in milliseconds; -9999 if there are
+     * none.
+     */
+    float getPhaseMean(sensorPhase phase);
+    /**
+     * @brief Get the longest duration of a phase in the timing profile.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @return **float** The longest duration in milliseconds; -9999 if there
+     * are none.
+     */
+    float getPhaseMax(sensorPhase phase);
+    /**
+     * @brief Get a short name for an update phase.
+     *
+     * @param phase The update phase; see #sensorPhase.
+     * @return **String** The name of the phase.
+     */
+    static String getPhaseName(sensorPhase phase);
+
 
  protected:
+    /**
+     * @brief Finish an update started with beginUpdate() - put the sensor
+     * back to sleep and power it down if the update woke and powered it, and
+     * notify the attached variables.
+     *
+     * @param state The final state of the update.
+     * @return **sensorUpdateState** The final state, passed through.
+     */
+    sensorUpdateState finishUpdate(sensorUpdateState state);
+    /**
+     * @brief Mark the sensor's power as just turned on.
+     *
+     * This sets the #_millisPowerOn timestamp and starts a new power cycle for
+     * recordReadiness(), so the first answer after it is learned from.  Every
+     * powerUp(), including those of sub-classes, calls this when it turns the
+     * power on.
+     */
+    void markPoweredOn(void);
+
     /**
      * @brief Digital pin number on the mcu receiving sensor data
      *
@@ -443,10 +956,28 @@ class Sensor {
      * @note SIGNED int, to allow negative numbers for unused pins
      */
     int8_t _powerPin;
+    /**
+     * @brief The port and bit of the #_powerPin, looked up once.
+     */
+    PinHandle _powerPinHandle;
+    /**
+     * @brief The kind of shared communication bus the sensor is attached to.
+     */
+    sensorBusType _busType;
+    /**
+     * @brief The identity of the shared communication bus the sensor is
+     * attached to.
+     */
+    uintptr_t _busId;
     /**
      * @brief The sensor name.
      */
     const char* _sensorName;
+    /**
+     * @brief The sensor name and location, put together by
+     * updateNameAndLocation(); empty until it's first needed.
+     */
+    char _nameAndLocation[MAX_NAME_LOCATION_LENGTH + 1];
     /**
      * @brief The number of values the sensor is capable of reporting.
      */
@@ -461,17 +992,84 @@ class Sensor {
      * requested.
      */
     uint8_t _measurementsToAverage;
+    /**
+     * @brief True while an update started by beginUpdate() is in progress.
+     */
+    bool _updateInProgress;
+    /**
+     * @brief True if the sensor had power when the update was started.
+     */
+    bool _updateWasOn;
+    /**
+     * @brief True if the sensor was already awake when the update was
+     * started.
+     */
+    bool _updateWasActive;
+    /**
+     * @brief The number of measurements finished in the current update.
+     */
+    uint8_t _updateMeasurementsDone;
+    /**
+     * @brief The number of logging intervals between samples of the sensor.
+     */
+    uint8_t _samplingInterval;
+    /**
+     * @brief True if the current values were carried forward from an earlier
+     * update rather than measured in the latest one.
+     */
+    bool _valuesStale;
     /**
      * @brief Array with the number of valid measurement values taken by the
      * sensor in the current update cycle.
      */
     uint8_t numberGoodMeasurementsMade[MAX_NUMBER_VARS];
+    /**
+     * @brief The first of the SensorStatistics objects attached to this
+     * sensor; each links to the next.  NULL if there are none.
+     */
+    SensorStatistics* _statistics;
+    /**
+     * @brief The sum of the raw ADC readings added in the current update.
+     */
+    int32_t _rawSum;
+    /**
+     * @brief The number of raw ADC readings added in the current update.
+     */
+    uint8_t _rawCount;
+    /**
+     * @brief The conversions of the mean raw reading into results; see
+     * setRawCalibration().
+     */
+    const rawResultCalibration* _rawCalibration;
+    /**
+     * @brief The number of conversions in #_rawCalibration.
+     */
+    uint8_t _rawCalibrationCount;
+    /**
+     * @brief The burst taken for each measurement; NULL for a single reading.
+     */
+    BurstSampler* _burstSampler;
 
     /**
      * @brief The time needed from the when a sensor has power until it's ready
      * to talk.
      */
     uint32_t _warmUpTime_ms;
+    /**
+     * @brief True if the warm-up time is learned from the sensor's answers;
+     * see setAdaptiveWarmUp().
+     */
+    bool _adaptiveWarmUp;
+    /**
+     * @brief True once the first answer after the last power on has been
+     * recorded by recordReadiness().
+     */
+    bool _readinessRecorded;
+    /**
+     * @brief The learned time from power on until the sensor first answers,
+     * without the margin.
+     */
+    uint32_t _learnedWarmUpTime_ms;
     /**
      * @brief The processor elapsed time when the power was turned on for the
      * sensor.
@@ -523,6 +1121,26 @@ class Sensor {
      * defined once for the whole class.
      */
     Variable* variables[MAX_NUMBER_VARS];
+
+#ifdef MS_CHECK_SENSOR_TIMING
+    /**
+     * @brief Ring buffers with the most recent durations of each update phase.
+     */
+    uint32_t _phaseHistory[SENSOR_PHASE_COUNT][MS_SENSOR_TIMING_HISTORY];
+    /**
+     * @brief The number of durations stored for each update phase.
+     */
+    uint8_t _phaseHistoryCount[SENSOR_PHASE_COUNT];
+    /**
+     * @brief The position of the next duration to store for each update phase.
+     */
+    uint8_t _phaseHistoryNext[SENSOR_PHASE_COUNT];
+    /**
+     * @brief The first of the SensorPhaseTiming objects attached to this
+     * sensor; each links to the next.  NULL if there are none.
+     */
+    SensorPhaseTiming* _phaseTiming;
+#endif
 };
 
 #endif  // SRC_SENSORBASE_H_
@@ -0,0 +1,144 @@
+/**
+ * @file ValueFormatter.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the ValueFormatter class.
+ */
+
+#include "ValueFormatter.h"
+
+// The powers of ten used to scale a value to a whole number of its last
+// decimal place
+static const uint32_t powersOfTen[MS_MAX_FORMATTED_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+// The largest value Arduino's Print will write as a number, rather than "ovf"
+static const float largestFormattedValue = 4294967040.0f;
+
+
+// Leaves an empty string in a buffer that's too small for the text
+static uint8_t writeNothing(char* buffer, size_t bufferSize) {
+    if (bufferSize > 0) buffer[0] = '\0';
+    return 0;
+}
+
+
+// Copies a short constant into the buffer
+static uint8_t writeText(char* buffer, size_t bufferSize, const char* text) {
+    uint8_t length = strlen(text);
+    if (length >= bufferSize) return writeNothing(buffer, bufferSize);
+    memcpy(buffer, text, length + 1);
+    return length;
+}
+
+
+// Splits a positive float into its whole number and its decimals, rounded
+// half up to the given number of places.  A float is a 24-bit whole number
+// times a power of two, so both parts are worked out exactly in integers;
+// neither the float scaled up nor its fraction times ten holds every digit.
+static void splitValue(float value, uint8_t decimalPlaces, uint32_t* wholePart,
+                       uint32_t* decimalPart) {
+    int      exponent;
+    uint32_t mantissa =
+        static_cast<uint32_t>(ldexp(frexp(value, &exponent), 24));
+    exponent -= 24;
+    *decimalPart = 0;
+    if (exponent >= 0) {
+        // A whole number; it is below 2^32 or it would have been "ovf"
+        *wholePart = mantissa << exponent;
+        return;
+    }
+
+    // The fraction is a whole number over 2^shift
+    uint8_t  shift = -exponent;
+    uint32_t fraction;
+    if (shift < 32) {
+        *wholePart = mantissa >> shift;
+        fraction   = mantissa & ((static_cast<uint32_t>(1) << shift) - 1);
+    } else {
+        *wholePart = 0;
+        fraction   = mantissa;
+    }
+    // Whole numbers are cut off rather than rounded, and a fraction this
+    // small never rounds up to the last decimal place
+    if (decimalPlaces == 0 || shift > 63) return;
+
+    // At most 24 bits times 10^8, so it fits in 64 bits
+    uint64_t scaled = static_cast<uint64_t>(fraction) *
+        powersOfTen[decimalPlaces];
+    *decimalPart = static_cast<uint32_t>(scaled >> shift) +
+        static_cast<uint32_t>((scaled >> (shift - 1)) & 1);
+}
+
+
+// The digits are written from the last one back, once the length is known
+uint8_t ValueFormatter::formatUnsigned(char* buffer, size_t bufferSize,
+                                       uint32_t value, uint8_t minDigits) {
+    uint8_t digits = 1;
+    for (uint32_t rest = value / 10; rest > 0; rest /= 10) digits++;
+    if (digits < minDigits) digits = minDigits;
+    if (digits >= bufferSize) return writeNothing(buffer, bufferSize);
+
+    buffer[digits] = '\0';
+    for (uint8_t i = digits; i > 0; i--) {
+        buffer[i - 1] = '0' + value % 10;
+        value /= 10;
+    }
+    return digits;
+}
+
+
+uint8_t ValueFormatter::formatFloat(char* buffer, size_t bufferSize,
+                                    float value, uint8_t decimalPlaces) {
+    if (decimalPlaces > MS_MAX_FORMATTED_DECIMALS) {
+        decimalPlaces = MS_MAX_FORMATTED_DECIMALS;
+    }
+    if (isnan(value)) return writeText(buffer, bufferSize, "nan");
+    if (isinf(value)) return writeText(buffer, bufferSize, "inf");
+    if (value > largestFormattedValue || value < -largestFormattedValue) {
+        return writeText(buffer, bufferSize, "ovf");
+    }
+
+    // A whole number cut off to zero has no sign
+    if (decimalPlaces == 0 && value > -1 && value < 0) value = 0;
+
+    uint8_t length = 0;
+    bool    isBad  = value == -9999;
+    if (value < 0) {
+        if (bufferSize < 2) return writeNothing(buffer, bufferSize);
+        buffer[length++] = '-';
+        value            = -value;
+    }
+
+    uint32_t scale = powersOfTen[decimalPlaces];
+    uint32_t wholePart;
+    uint32_t decimalPart;
+    if (isBad) {
+        wholePart   = 9999;
+        decimalPart = 0;
+    } else {
+        splitValue(value, decimalPlaces, &wholePart, &decimalPart);
+        // Rounding up the decimals can carry into the whole number
+        if (decimalPart >= scale) {
+            wholePart++;
+            decimalPart -= scale;
+        }
+    }
+
+    uint8_t written = formatUnsigned(buffer + length, bufferSize - length,
+                                     wholePart);
+    if (written == 0) return writeNothing(buffer, bufferSize);
+    length += written;
+    if (decimalPlaces > 0) {
+        if (length + 1u >= bufferSize) {
+            return writeNothing(buffer, bufferSize);
+        }
+        buffer[length++] = '.';
+        written = formatUnsigned(buffer + length, bufferSize - length,
+                                 decimalPart, decimalPlaces);
+        if (written == 0) return writeNothing(buffer, bufferSize);
+        length += written;
+    }
+    return length;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file ValueFormatter.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the ValueFormatter class, for writing numbers as text
+ * straight into a character buffer.
+ */
+
+// Header Guards
+#ifndef SRC_VALUEFORMATTER_H_
+#define SRC_VALUEFORMATTER_H_
+
+// Included Dependencies
+#include <Arduino.h>
+
+/**
+ * @brief The most decimal places written for a float; a float has fewer
+ * significant digits than this anyway.
+ */
+#define MS_MAX_FORMATTED_DECIMALS 8
+
+/**
+ * @brief The length of the longest float written by
+ * ValueFormatter::formatFloat(); a sign, ten digits, a decimal point, and
+ * #MS_MAX_FORMATTED_DECIMALS decimals.
+ */
+#define MS_MAX_FORMATTED_FLOAT_LENGTH (12 + MS_MAX_FORMATTED_DECIMALS)
+
+/**
+ * @brief Writes numbers as text into a character buffer supplied by the
+ * caller, without making an Arduino String or a second copy of the text.
+ *
+ * The text is always terminated.  If it doesn't fit in the buffer nothing but
+ * the terminator is written and 0 is returned.
+ */
+class ValueFormatter {
+ public:
+    /**
+     * @brief Write a float with a fixed number of decimal places.
+     *
+     * The text matches that of `String(value, decimalPlaces)`; the digits
+     * are worked out exactly from the float, and a value exactly half way
+     * between two last digits is rounded up.  Values with no decimal places
+     * are cut off toward zero rather than rounded, as a variable with a
+     * resolution of 0 always has been.  The bad value -9999 is written
+     * without doing any math.
+     *
+     * @param buffer The buffer to write into.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @param value The value to write.
+     * @param decimalPlaces The number of decimal places; at most
+     * #MS_MAX_FORMATTED_DECIMALS are written.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator.
+     */
+    static uint8_t formatFloat(char* buffer, size_t bufferSize, float value,
+                               uint8_t decimalPlaces);
+    /**
+     * @brief Write an unsigned integer, padded with leading zeros.
+     *
+     * @param buffer The buffer to write into.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @param value The value to write.
+     * @param minDigits The least number of digits to write; optional with a
+     * default value of 1.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator.
+     */
+    static uint8_t formatUnsigned(char* buffer, size_t bufferSize,
+                                  uint32_t value, uint8_t minDigits = 1);
+};
+
+#endif  // SRC_VALUEFORMATTER_H_
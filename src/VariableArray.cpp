@@ -9,19 +9,39 @@
 
 #include "VariableArray.h"
 
-
 // Constructors
-VariableArray::VariableArray() {}
+VariableArray::VariableArray()
+    : _variableCount(0),
+      _sensorCount(0),
+      _pinGroupCount(0),
+      _busGroupCount(0),
+      _updateCycle(0),
+      _predictedUpdateTime_ms(0),
+      _lastUpdateTime_ms(0),
+      _updateTimeout_ms(0),
+      _work(NULL) {}
 VariableArray::VariableArray(uint8_t variableCount, Variable* variableList[])
-    : arrayOfVars(variableList), _variableCount(variableCount) {
+    : arrayOfVars(variableList),
+      _variableCount(variableCount),
+      _updateCycle(0),
+      _predictedUpdateTime_ms(0),
+      _lastUpdateTime_ms(0),
+      _updateTimeout_ms(0),
+      _work(NULL) {
+    buildSensorTables();
     _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
 }
 VariableArray::VariableArray(uint8_t variableCount, Variable* variableList[],
                              const char* uuids[])
-    : arrayOfVars(variableList), _variableCount(variableCount) {
+    : arrayOfVars(variableList),
+      _variableCount(variableCount),
+      _updateCycle(0),
+      _predictedUpdateTime_ms(0),
+      _lastUpdateTime_ms(0),
+      _updateTimeout_ms(0),
+      _work(NULL) {
+    buildSensorTables();
     _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
     matchUUIDs(uuids);
 }
 
@@ -33,8 +53,8 @@ void VariableArray::begin(uint8_t variableCount, Variable* variableList[],
     _variableCount = variableCount;
     arrayOfVars    = variableList;
 
+    buildSensorTables();
     _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
     matchUUIDs(uuids);
     checkVariableUUIDs();
 }
@@ -42,13 +62,13 @@ void VariableArray::begin(uint8_t variableCount, Variable* variableList[]) {
     _variableCount = variableCount;
     arrayOfVars    = variableList;
 
+    buildSensorTables();
     _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
     checkVariableUUIDs();
 }
 void VariableArray::begin() {
+    buildSensorTables();
     _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
     checkVariableUUIDs();
 }
 
@@ -64,15 +84,10 @@ uint8_t VariableArray::getCalculatedVariableCount(void) {
 }
 
 
-// This counts and returns the number of sensors
+// This returns the number of sensors found when the array was begun
 uint8_t VariableArray::getSensorCount(void) {
-    uint8_t numSensors = 0;
-    // Check for unique sensors
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) numSensors++;
-    }
-    // MS_DBG(F("There are"), numSensors, F("unique sensors in the group."));
-    return numSensors;
+    // MS_DBG(F("There are"), _sensorCount, F("unique sensors in the group."));
+    return _sensorCount;
 }
 
 // This matches UUID's from an array of pointers to the variable array
@@ -87,10 +102,12 @@ void VariableArray::matchUUIDs(const char* uuids[]) {
 // Public functions for interfacing with a list of sensors
 // This sets up all of the sensors in the list
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 bool VariableArray::setupSensors(void) {
     bool success = true;
+    // The working state is on the stack only while this runs
+    sensorWorkState work[_sensorCount > 0 ? _sensorCount : 1];
+    _work = work;
 
     // #ifdef MS_VARIABLEARRAY_DEBUG_DEEP
     // bool deepDebugTiming = true;
@@ -106,37 +123,50 @@ bool VariableArray::setupSensors(void) {
     // for (uint8_t i = 0; i < _variableCount; i++)
     //     arrayOfVars[i]->setup();
 
-    // Power all of the sensors
-    // NOTE:  Because we are running this *before* running each sensor's setup
-    // function, this may actually fail to power a sensors if the pin mode for
-    // that sensor's power pin is not correct.  The pin modes are set *during*
-    // most sensor's set-up function.  For this reason, each sensor that
-    // requires power for setup should have a powerUp() and waitForWarmup()
-    // written into its setup function. But, for logger boards that have been
-    // programmed more than once, the pin mode from the previous power up of the
-    // MCU is usually retained so chances are high that this will actually power
-    // up the sensors. If this does successfully power up the sensors, it saves
-    // us all of the waitForWarmup() time and prevents the power from flickering
-    // on and off during setup in cases where many sensors are powered on the
-    // same circuit. MS_DBG(F("Powering up sensors for setup."));
-    // sensorsPowerUp();
+#ifndef MS_SERIAL_SENSOR_SETUP
+    // Power all of the sensors that still need to be set up at once, so their
+    // warm-up times overlap.  The sensors' own set-up functions haven't set
+    // the pin modes yet, and not every powerUp() sets it, so every power pin
+    // is made an output first; otherwise writing it high would only turn on
+    // its pull-up and checking it would read a floating input.  The sensors
+    // that need power for set up check whether it was already on and wait for
+    // their warm-up, so they'll leave the power on for each other.  Check all
+    // of the power first so that every sensor on a pin that was off is powered
+    // down again at the end.
+    MS_DBG(F("Powering up sensors for setup."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (_sensorList[s]->getPowerPin() >= 0) {
+            pinMode(_sensorList[s]->getPowerPin(), OUTPUT);
+        }
+    }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].poweredForSetup =
+            bitRead(_sensorList[s]->getStatus(), 0) == 0 &&
+            !_sensorList[s]->checkPowerOn();
+    }
+    for (uint8_t i = 0; i < _sensorCount; i++) {
+        uint8_t s = _sensorOrder[i];
+        if (_work[s].poweredForSetup) _sensorList[s]->powerUp();
+    }
+#endif
 
     // Now run all the set-up functions
     MS_DBG(F("Running sensor setup functions."));
 
     // Check for any sensors that have been set up outside of this (ie, the
     // modem)
+    // idleUntilNextEvent() waits on the sensors with measurements left to
+    // take, so each sensor still to be set up is counted as having one
     uint8_t nSensorsSetup = 0;
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 0) ==
-                1) {  // already set up
-                MS_DBG(F("   "),
-                       arrayOfVars[i]->getParentSensorNameAndLocation(),
-                       F("was already set up!"));
-
-                nSensorsSetup++;
-            }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].nCompleted = 0;
+        _work[s].nToAverage = 1;
+        if (bitRead(_sensorList[s]->getStatus(), 0) == 1) {  // already set up
+            MS_DBG(F("   "), _sensorList[s]->getSensorNameAndLocation(),
+                   F("was already set up!"));
+
+            nSensorsSetup++;
+            _work[s].nCompleted = 1;
         }
     }
 
@@ -145,41 +175,48 @@ bool VariableArray::setupSensors(void) {
     // up and increment the counter marking that's been done.
     // We keep looping until they've all been done.
     while (nSensorsSetup < _sensorCount) {
-        for (uint8_t i = 0; i < _variableCount; i++) {
+        bool anySetUp = false;
+        for (uint8_t s = 0; s < _sensorCount; s++) {
             bool sensorSuccess = false;
-            if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-                // only set up if it has not yet been set up
-                if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 0) ==
-                    0) {
-                    // and if it is already warmed up
-                    // if
-                    // (arrayOfVars[i]->parentSensor->isWarmedUp(deepDebugTiming))
-                    // {
-                    MS_DBG(F("    Set up of"),
-                           arrayOfVars[i]->getParentSensorNameAndLocation(),
-                           F("..."));
-
-                    sensorSuccess =
-                        arrayOfVars[i]->parentSensor->setup();  // set it up
-                    success &= sensorSuccess;
-                    nSensorsSetup++;
+            // only set up if it has not yet been set up
+            if (bitRead(_sensorList[s]->getStatus(), 0) == 0) {
+#ifndef MS_SERIAL_SENSOR_SETUP
+                // and if it is already warmed up
+                if (!_sensorList[s]->isWarmedUp()) continue;
+#endif
+                MS_DBG(F("    Set up of"),
+                       _sensorList[s]->getSensorNameAndLocation(), F("..."));
 
-                    if (!sensorSuccess) {
-                        MS_DBG(F("        ... setup failed!"));
-                    } else {
-                        MS_DBG(F("        ... setup succeeded."));
-                    }
-                    // }
+                sensorSuccess = _sensorList[s]->setup();  // set it up
+                success &= sensorSuccess;
+                nSensorsSetup++;
+                anySetUp                   = true;
+                _work[s].nCompleted = 1;
+                // Some sensors only learn their address during set up
+                _sensorList[s]->updateNameAndLocation();
+
+                if (!sensorSuccess) {
+                    MS_DBG(F("        ... setup failed!"));
+                } else {
+                    MS_DBG(F("        ... setup succeeded."));
                 }
             }
         }
+
+        // Idle until the next sensor is warmed up, rather than spinning
+        if (!anySetUp) idleUntilNextEvent();
     }
 
-    // Power down all sensor;
-    // sensorsPowerDown();
+#ifndef MS_SERIAL_SENSOR_SETUP
+    // Turn off any power that was turned on for the set up
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (_work[s].poweredForSetup) _sensorList[s]->powerDown();
+    }
+#endif
 
     if (success) { MS_DBG(F("... Success!")); }
 
+    _work = NULL;
     return success;
 }
 
@@ -187,17 +224,15 @@ bool VariableArray::setupSensors(void) {
 // This powers up the sensors
 // There's no checking or waiting here, just turning on pins
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 void VariableArray::sensorsPowerUp(void) {
     MS_DBG(F("Powering up sensors..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            MS_DBG(F("    Powering up"),
-                   arrayOfVars[i]->getParentSensorNameAndLocation());
+    for (uint8_t i = 0; i < _sensorCount; i++) {
+        uint8_t s = _sensorOrder[i];
+        MS_DBG(F("    Powering up"),
+               _sensorList[s]->getSensorNameAndLocation());
 
-            arrayOfVars[i]->parentSensor->powerUp();
-        }
+        _sensorList[s]->powerUp();
     }
 }
 
@@ -205,8 +240,7 @@ void VariableArray::sensorsPowerUp(void) {
 // This wakes/activates the sensors
 // Before a sensor is "awoken" we have to make sure it's had time to warm up
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 bool VariableArray::sensorsWake(void) {
     MS_DBG(F("Waking sensors..."));
     bool    success       = true;
@@ -220,15 +254,13 @@ bool VariableArray::sensorsWake(void) {
 
     // Check for any sensors that are awake outside of being sent a "wake"
     // command
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                1) {  // already attempted to wake
-                MS_DBG(F("    Wake up of"),
-                       arrayOfVars[i]->getParentSensorNameAndLocation(),
-                       F("has already been attempted."));
-                nSensorsAwake++;
-            }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (bitRead(_sensorList[s]->getStatus(), 3) ==
+            1) {  // already attempted to wake
+            MS_DBG(F("    Wake up of"),
+                   _sensorList[s]->getSensorNameAndLocation(),
+                   F("has already been attempted."));
+            nSensorsAwake++;
         }
     }
 
@@ -237,32 +269,27 @@ bool VariableArray::sensorsWake(void) {
     // up and increment the counter marking that's been done.
     // We keep looping until they've all been done.
     while (nSensorsAwake < _sensorCount) {
-        for (uint8_t i = 0; i < _variableCount; i++) {
-            if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-                // If no attempts yet made to wake the sensor up
-                if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                    0) {
-                    // and if it is already warmed up
-                    if (arrayOfVars[i]->parentSensor->isWarmedUp(
-                            deepDebugTiming)) {
-                        MS_DBG(F("    Wake up of"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
-                               F("..."));
+        for (uint8_t s = 0; s < _sensorCount; s++) {
+            // If no attempts yet made to wake the sensor up
+            if (bitRead(_sensorList[s]->getStatus(), 3) == 0) {
+                // and if it is already warmed up
+                if (_sensorList[s]->isWarmedUp(deepDebugTiming)) {
+                    MS_DBG(F("    Wake up of"),
+                           _sensorList[s]->getSensorNameAndLocation(),
+                           F("..."));
 
-                        // Make a single attempt to wake the sensor after it is
-                        // warmed up
-                        bool sensorSuccess =
-                            arrayOfVars[i]->parentSensor->wake();
-                        success &= sensorSuccess;
-                        // We increment up the number of sensors awake/active,
-                        // even if the wake up command failed!
-                        nSensorsAwake++;
-
-                        if (sensorSuccess) {
-                            MS_DBG(F("        ... wake up succeeded."));
-                        } else {
-                            MS_DBG(F("        ... wake up failed!"));
-                        }
+                    // Make a single attempt to wake the sensor after it is
+                    // warmed up
+                    bool sensorSuccess = _sensorList[s]->wake();
+                    success &= sensorSuccess;
+                    // We increment up the number of sensors awake/active,
+                    // even if the wake up command failed!
+                    nSensorsAwake++;
+
+                    if (sensorSuccess) {
+                        MS_DBG(F("        ... wake up succeeded."));
+                    } else {
+                        MS_DBG(F("        ... wake up failed!"));
                     }
                 }
             }
@@ -276,24 +303,21 @@ bool VariableArray::sensorsWake(void) {
 // We're not waiting for anything to be ready, we're just sending the command
 // to put it to sleep no matter what its current state is.
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 bool VariableArray::sensorsSleep(void) {
     MS_DBG(F("Putting sensors to sleep..."));
     bool success = true;
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            MS_DBG(F("    "), arrayOfVars[i]->getParentSensorNameAndLocation(),
-                   F("..."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        MS_DBG(F("    "), _sensorList[s]->getSensorNameAndLocation(),
+               F("..."));
 
-            bool sensorSuccess = arrayOfVars[i]->parentSensor->sleep();
-            success &= sensorSuccess;
+        bool sensorSuccess = _sensorList[s]->sleep();
+        success &= sensorSuccess;
 
-            if (sensorSuccess) {
-                MS_DBG(F("        ... successfully put to sleep."));
-            } else {
-                MS_DBG(F("        ... failed to sleep!"));
-            }
+        if (sensorSuccess) {
+            MS_DBG(F("        ... successfully put to sleep."));
+        } else {
+            MS_DBG(F("        ... failed to sleep!"));
         }
     }
     return success;
@@ -303,17 +327,14 @@ bool VariableArray::sensorsSleep(void) {
 // This cuts power to the sensors
 // We're not waiting for anything to be ready, we're just cutting power.
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 void VariableArray::sensorsPowerDown(void) {
     MS_DBG(F("Powering down sensors..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            MS_DBG(F("    Powering down"),
-                   arrayOfVars[i]->getParentSensorNameAndLocation());
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        MS_DBG(F("    Powering down"),
+               _sensorList[s]->getSensorNameAndLocation());
 
-            arrayOfVars[i]->parentSensor->powerDown();
-        }
+        _sensorList[s]->powerDown();
     }
 }
 
@@ -323,11 +344,13 @@ void VariableArray::sensorsPowerDown(void) {
 // the startSingleMeasurement and addSingleMeasurementResult functions to
 // take advantage of the ability of sensors to be measuring concurrently.
 // NOTE:  Calculated variables will always be skipped in this process because
-// a calculated variable will never be marked as the last variable from a
-// sensor.
+// they are never in the sensor list.
 bool VariableArray::updateAllSensors(void) {
     bool    success           = true;
     uint8_t nSensorsCompleted = 0;
+    // The working state is on the stack only while this runs
+    sensorWorkState work[_sensorCount > 0 ? _sensorCount : 1];
+    _work = work;
 
 #ifdef MS_VARIABLEARRAY_DEBUG_DEEP
     bool deepDebugTiming = true;
@@ -335,120 +358,101 @@ bool VariableArray::updateAllSensors(void) {
     bool deepDebugTiming = false;
 #endif
 
-    // Create an array with the unique-ness value (so we can skip the function
-    // calls later)
-    MS_DBG(F("Creating a mask array with the uniqueness for each sensor.."));
-    bool lastSensorVariable[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        lastSensorVariable[i] = isLastVarFromSensor(i);
-    }
-
-    // Create an array for the number of measurements already completed and set
-    // all to zero
-    MS_DBG(F("Creating an array for the number of completed measurements.."));
-    uint8_t nMeasurementsCompleted[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        nMeasurementsCompleted[i] = 0;
+    // Set the number of measurements already completed to zero
+    MS_DBG(F("Resetting the number of completed measurements.."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].nCompleted = 0;
     }
 
-    // Create an array for the number of measurements to average (another short
-    // cut)
-    MS_DBG(F("Creating an array with the number of measurements to average.."));
-    uint8_t nMeasurementsToAverage[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            nMeasurementsToAverage[i] =
-                arrayOfVars[i]->parentSensor->getNumberMeasurementsToAverage();
-        } else {
-            nMeasurementsToAverage[i] = 0;
-        }
+    // Get the number of measurements to average (another short cut)
+    MS_DBG(F("Getting the number of measurements to average.."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].nToAverage = _sensorList[s]->getNumberMeasurementsToAverage();
     }
 
     // Clear the initial variable arrays
     MS_DBG(F("----->> Clearing all results arrays before taking new "
              "measurements. ..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            arrayOfVars[i]->parentSensor->clearValues();
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _sensorList[s]->clearValues();
     }
     MS_DBG(F("    ... Complete. <<-----"));
 
     // Check for any sensors that didn't wake up and mark them as "complete" so
     // they will be skipped in further looping.
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {  // Skip non-unique sensors
-            if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                    0 ||  // No attempt made to wake the sensor up
-                bitRead(arrayOfVars[i]->parentSensor->getStatus(), 4) ==
-                    0) {  // OR Wake up failed
-                MS_DBG(i, F("--->>"),
-                       arrayOfVars[i]->getParentSensorNameAndLocation(),
-                       F("isn't awake/active!  No measurements will be taken! "
-                         "<<---"),
-                       i);
-
-                // Set the number of measurements already equal to whatever
-                // total number requested to ensure the sensor is skipped in
-                // further loops.
-                nMeasurementsCompleted[i] = nMeasurementsToAverage[i];
-                // Bump up the finished count.
-                nSensorsCompleted++;
-            }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (bitRead(_sensorList[s]->getStatus(), 3) ==
+                0 ||  // No attempt made to wake the sensor up
+            bitRead(_sensorList[s]->getStatus(), 4) ==
+                0) {  // OR Wake up failed
+            MS_DBG(s, F("--->>"), _sensorList[s]->getSensorNameAndLocation(),
+                   F("isn't awake/active!  No measurements will be taken! "
+                     "<<---"),
+                   s);
+
+            // Set the number of measurements already equal to whatever
+            // total number requested to ensure the sensor is skipped in
+            // further loops.
+            _work[s].nCompleted = _work[s].nToAverage;
+            // Bump up the finished count.
+            nSensorsCompleted++;
         }
     }
 
     while (nSensorsCompleted < _sensorCount) {
-        for (uint8_t i = 0; i < _variableCount; i++) {
+        for (uint8_t b = 0; b < _busGroupCount; b++) {
+            _work[b].busUsed = false;
+        }
+        for (uint8_t s = 0; s < _sensorCount; s++) {
             /***
             // THIS IS PURELY FOR DEEP DEBUGGING OF THE TIMING!
             // Leave this whole section commented out unless you want excessive
             // printouts (ie, thousands of lines) of the timing information!!
-            if (lastSensorVariable[i] and
-                nMeasurementsToAverage[i] > nMeasurementsCompleted[i])
-            {
-                MS_DEEP_DBG(i), '-',
-            arrayOfVars[i]->getParentSensorNameAndLocation(), F("- millis:"),
-            millis(), F("- status: 0b"),
-                           bitRead(arrayOfVars[i]->parentSensor->getStatus(),
-            7), bitRead(arrayOfVars[i]->parentSensor->getStatus(), 6),
-                           bitRead(arrayOfVars[i]->parentSensor->getStatus(),
-            5), bitRead(arrayOfVars[i]->parentSensor->getStatus(), 4),
-                           bitRead(arrayOfVars[i]->parentSensor->getStatus(),
-            3), bitRead(arrayOfVars[i]->parentSensor->getStatus(), 2),
-                           bitRead(arrayOfVars[i]->parentSensor->getStatus(),
-            1), bitRead(arrayOfVars[i]->parentSensor->getStatus(), 0), F("-
-            measurement #"), (nMeasurementsCompleted[i] + 1);
+            if (_work[s].nToAverage > _work[s].nCompleted) {
+                MS_DEEP_DBG(
+                    s, '-', _sensorList[s]->getSensorNameAndLocation(),
+                    F("- millis:"), millis(), F("- status: 0b"),
+                    bitRead(_sensorList[s]->getStatus(), 7),
+                    bitRead(_sensorList[s]->getStatus(), 6),
+                    bitRead(_sensorList[s]->getStatus(), 5),
+                    bitRead(_sensorList[s]->getStatus(), 4),
+                    bitRead(_sensorList[s]->getStatus(), 3),
+                    bitRead(_sensorList[s]->getStatus(), 2),
+                    bitRead(_sensorList[s]->getStatus(), 1),
+                    bitRead(_sensorList[s]->getStatus(), 0),
+                    F("- measurement #"), (_work[s].nCompleted + 1));
             }
             // END CHUNK FOR DEBUGGING!
             ***/
 
             // Only do checks on sensors that still have measurements to finish
-            if (lastSensorVariable[i] &&
-                nMeasurementsToAverage[i] > nMeasurementsCompleted[i]) {
+            // and whose bus hasn't already been used in this pass
+            uint8_t b = _sensorBusGroup[s];
+            if (_work[s].nToAverage > _work[s].nCompleted &&
+                !_work[b].busUsed) {
                 // first, make sure the sensor is stable
-                if (arrayOfVars[i]->parentSensor->isStable(deepDebugTiming)) {
+                if (_sensorList[s]->isStable(deepDebugTiming)) {
                     // now, if the sensor is not currently measuring...
-                    if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 5) ==
+                    if (bitRead(_sensorList[s]->getStatus(), 5) ==
                         0) {  // NO attempt yet to start a measurement
                         // Start a reading
-                        MS_DBG(i, '.', nMeasurementsCompleted[i] + 1,
+                        MS_DBG(s, '.', _work[s].nCompleted + 1,
                                F("--->> Starting reading"),
-                               nMeasurementsCompleted[i] + 1, F("on"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
+                               _work[s].nCompleted + 1, F("on"),
+                               _sensorList[s]->getSensorNameAndLocation(),
                                '-');
 
                         bool sensorSuccess_start =
-                            arrayOfVars[i]
-                                ->parentSensor->startSingleMeasurement();
+                            _sensorList[s]->startSingleMeasurement();
                         success &= sensorSuccess_start;
+                        _work[b].busUsed = true;
 
                         if (sensorSuccess_start) {
-                            MS_DBG(F("   ... reading started! <<---"), i, '.',
-                                   nMeasurementsCompleted[i] + 1);
+                            MS_DBG(F("   ... reading started! <<---"), s, '.',
+                                   _work[s].nCompleted + 1);
                         } else {
                             MS_DBG(F("   ... failed to start reading! <<---"),
-                                   i, '.', nMeasurementsCompleted[i] + 1);
+                                   s, '.', _work[s].nCompleted + 1);
                         }
                     }
 
@@ -460,39 +464,40 @@ bool VariableArray::updateAllSensors(void) {
                     // measurement failed (bit 6 not set).  In that case, the
                     // addSingleMeasurementResult() will be "adding" -9999
                     // values.
-                    if (arrayOfVars[i]->parentSensor->isMeasurementComplete(
+                    if (!_work[b].busUsed &&
+                        _sensorList[s]->isMeasurementComplete(
                             deepDebugTiming)) {
                         // Get the value
-                        MS_DBG(i, '.', nMeasurementsCompleted[i] + 1,
+                        MS_DBG(s, '.', _work[s].nCompleted + 1,
                                F("--->> Collected result of reading"),
-                               nMeasurementsCompleted[i] + 1, F("from"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
+                               _work[s].nCompleted + 1, F("from"),
+                               _sensorList[s]->getSensorNameAndLocation(),
                                F("..."));
 
                         bool sensorSuccess_result =
-                            arrayOfVars[i]
-                                ->parentSensor->addSingleMeasurementResult();
+                            _sensorList[s]->addSingleMeasurementResult();
                         success &= sensorSuccess_result;
-                        nMeasurementsCompleted[i] +=
+                        _work[b].busUsed = true;
+                        _work[s].nCompleted +=
                             1;  // increment the number of measurements that
                                 // sensor has completed
 
                         if (sensorSuccess_result) {
-                            MS_DBG(F("   ... got measurement result. <<---"), i,
-                                   '.', nMeasurementsCompleted[i]);
+                            MS_DBG(F("   ... got measurement result. <<---"), s,
+                                   '.', _work[s].nCompleted);
                         } else {
                             MS_DBG(F("   ... failed to get measurement result! "
                                      "<<---"),
-                                   i, '.', nMeasurementsCompleted[i]);
+                                   s, '.', _work[s].nCompleted);
                         }
                     }
                 }
 
                 // if all the measurements are done, mark the whole sensor as
                 // done
-                if (nMeasurementsCompleted[i] == nMeasurementsToAverage[i]) {
+                if (_work[s].nCompleted == _work[s].nToAverage) {
                     MS_DBG(F("--- Finished all measurements from"),
-                           arrayOfVars[i]->getParentSensorNameAndLocation(),
+                           _sensorList[s]->getSensorNameAndLocation(),
                            F("---"));
 
                     nSensorsCompleted++;
@@ -501,22 +506,35 @@ bool VariableArray::updateAllSensors(void) {
                 }
             }
         }
+
+        // Idle until the next sensor is ready for its next step
+        idleUntilNextEvent();
     }
 
     // Average measurements and notify varibles of the updates
     MS_DBG(F("----->> Averaging results and notifying all variables. ..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            // MS_DBG(F("--- Averaging results from"),
-            // arrayOfVars[i]->getParentSensorNameAndLocation(), F("---"));
-            arrayOfVars[i]->parentSensor->averageMeasurements();
-            // MS_DBG(F("--- Notifying variables from"),
-            // arrayOfVars[i]->getParentSensorNameAndLocation(), F("---"));
-            arrayOfVars[i]->parentSensor->notifyVariables();
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        // MS_DBG(F("--- Averaging results from"),
+        // _sensorList[s]->getSensorNameAndLocation(), F("---"));
+        _sensorList[s]->averageMeasurements();
+        // MS_DBG(F("--- Notifying variables from"),
+        // _sensorList[s]->getSensorNameAndLocation(), F("---"));
+        _sensorList[s]->notifyVariables();
     }
     MS_DBG(F("... Complete. <<-----"));
 
+    // Keep the values and value strings for the CSV file and publishers.
+    // Measured variables of sensors that were updated have already dropped
+    // their snapshots; the calculated variables are calculated again, once
+    // each, in the order of their inputs.
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (arrayOfVars[i]->isCalculated) arrayOfVars[i]->clearSnapshot();
+    }
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (!arrayOfVars[i]->hasSnapshot()) arrayOfVars[i]->takeSnapshot();
+    }
+
+    _work = NULL;
     return success;
 }
 
@@ -524,8 +542,14 @@ bool VariableArray::updateAllSensors(void) {
 // This function is an even more complete version of the updateAllSensors
 // function - it handles power up/down and wake/sleep.
 bool VariableArray::completeUpdate(void) {
+    return completeUpdate(_updateCycle++);
+}
+bool VariableArray::completeUpdate(uint32_t updateCycle) {
     bool    success           = true;
     uint8_t nSensorsCompleted = 0;
+    // The working state is on the stack only while this runs
+    sensorWorkState work[_sensorCount > 0 ? _sensorCount : 1];
+    _work = work;
 
 #ifdef MS_VARIABLEARRAY_DEBUG_DEEP
     bool deepDebugTiming = true;
@@ -533,197 +557,161 @@ bool VariableArray::completeUpdate(void) {
     bool deepDebugTiming = false;
 #endif
 
-    // Create an array with the unique-ness value (so we can skip the function
-    // calls later)
-    MS_DBG(F("Creating a mask array with the uniqueness for each sensor.."));
-    bool lastSensorVariable[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        lastSensorVariable[i] = isLastVarFromSensor(i);
+    // Set the number of measurements already completed to zero
+    MS_DBG(F("Resetting the number of completed measurements.."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].nCompleted = 0;
     }
 
-    // Create an array for the number of measurements already completed and set
-    // all to zero
-    MS_DBG(F("Creating an array for the number of completed measurements.."));
-    uint8_t nMeasurementsCompleted[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        nMeasurementsCompleted[i] = 0;
+    // Get the number of measurements to average (another short cut)
+    MS_DBG(F("Getting the number of measurements to average.."));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].nToAverage = _sensorList[s]->getNumberMeasurementsToAverage();
     }
 
-    // Create an array for the number of measurements to average (another short
-    // cut)
-    MS_DBG(F("Creating an array with the number of measurements to average.."));
-    uint8_t nMeasurementsToAverage[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            nMeasurementsToAverage[i] =
-                arrayOfVars[i]->parentSensor->getNumberMeasurementsToAverage();
-        } else {
-            nMeasurementsToAverage[i] = 0;
+    // Check which sensors are due to be sampled in this cycle.  Sensors that
+    // aren't due are given no measurements to take and counted as complete
+    // from the start, so they are never powered or woken; their last values
+    // are carried forward and flagged as stale.
+    MS_DBG(F("Checking which sensors are due in update cycle"), updateCycle);
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].due = _sensorList[s]->isSamplingDue(updateCycle);
+        if (!_work[s].due) {
+            MS_DBG(s, F("--->>"), _sensorList[s]->getSensorNameAndLocation(),
+                   F("is not due, carrying forward its last values."));
+            _sensorList[s]->markValuesStale();
+            _work[s].nToAverage = 0;
+            nSensorsCompleted++;
         }
     }
 
-    // Create an array of the power pins
-    MS_DBG(F("Creating an array of the power pins.."));
-    int8_t powerPins[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            powerPins[i] = arrayOfVars[i]->parentSensor->getPowerPin();
-        } else {
-            powerPins[i] = 0;
-        }
-    }
-
-    // Create an array of the last variable on each power pin
-    MS_DBG(F("Creating arrays of the power pin locations.."));
-    bool lastPinVariable[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) { lastPinVariable[i] = 1; }
-    // Create an array containing the index of the power pin in the powerPins
-    // array
-    int8_t powerPinIndex[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) { powerPinIndex[i] = 0; }
-    // Create an array to tell us how many measurements must be taken
-    // before all the sensors attached to a power pin are done
-    uint8_t nMeasurementsOnPin[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        nMeasurementsOnPin[i] = nMeasurementsToAverage[i];
-    }
-    // Now correctly populate the previous three arrays
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        for (uint8_t j = i + 1; j < _variableCount; j++) {
-            if (!lastSensorVariable[i]) {
-                lastPinVariable[i] = 0;
-                // MS_DBG(i, F("isn't the last variable on power pin because not
-                // last on sensor."));
-            } else if (powerPins[i] == powerPins[j]) {
-                lastPinVariable[i] = 0;
-                // MS_DBG(i, F("isn't the last variable on power pin, matches"),
-                // j);
-            }
-            i++;
-        }
+    // Count how many measurements must be taken before all the sensors
+    // attached to a power pin are done and how many of those have already
+    // been completed.  The power pin groups themselves were set in begin(), but
+    // the number of measurements to average may have changed.
+    MS_DBG(F("Counting the measurements on each power pin.."));
+    for (uint8_t g = 0; g < _pinGroupCount; g++) {
+        _work[g].nOnPin          = 0;
+        _work[g].nCompletedOnPin = 0;
     }
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastPinVariable[i]) {
-            powerPinIndex[i]      = i;
-            nMeasurementsOnPin[i] = nMeasurementsToAverage[i];
-            for (uint8_t j = 0; j < _variableCount; j++) {
-                if (powerPins[j] == powerPins[i] && i != j) {
-                    powerPinIndex[j] = i;
-                    nMeasurementsOnPin[i] += nMeasurementsToAverage[j];
-                    nMeasurementsOnPin[j] = 0;
-                }
-            }
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[_sensorPinGroup[s]].nOnPin += _work[s].nToAverage;
     }
 
 // This is just for debugging
 #ifdef MS_VARIABLEARRAY_DEBUG_DEEP
-    uint8_t arrayPositions[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) { arrayPositions[i] = i; }
-    String nameLocation[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        // nameLocation[i] = arrayOfVars[i]->getParentSensorNameAndLocation();
-        nameLocation[i] = arrayOfVars[i]->getParentSensorName();
-    }
     MS_DEEP_DBG(F("----------------------------------"));
-    MS_DEEP_DBG(F("arrayPositions:\t\t\t"));
-    prettyPrintArray(arrayPositions);
     MS_DEEP_DBG(F("sensor:\t\t\t"));
-    prettyPrintArray(nameLocation);
-    MS_DEEP_DBG(F("lastSensorVariable:\t\t"));
-    prettyPrintArray(lastSensorVariable);
+    DEEP_DEBUGGING_SERIAL_OUTPUT.print("[,\t");
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        DEEP_DEBUGGING_SERIAL_OUTPUT.print(_sensorList[s]->getSensorName());
+        DEEP_DEBUGGING_SERIAL_OUTPUT.print(",\t");
+    }
+    DEEP_DEBUGGING_SERIAL_OUTPUT.println("]");
+    MS_DEEP_DBG(F("arrayPositions:\t\t\t"));
+    prettyPrintArray(_sensorVarIndex);
     MS_DEEP_DBG(F("nMeasurementsToAverage:\t\t"));
-    prettyPrintArray(nMeasurementsToAverage);
+    prettyPrintArray(&sensorWorkState::nToAverage);
     MS_DEEP_DBG(F("nMeasurementsCompleted:\t\t"));
-    prettyPrintArray(nMeasurementsCompleted);
-    MS_DEEP_DBG(F("powerPins:\t\t\t"));
-    prettyPrintArray(powerPins);
-    MS_DEEP_DBG(F("lastPinVariable:\t\t"));
-    prettyPrintArray(lastPinVariable);
-    MS_DEEP_DBG(F("powerPinIndex:\t\t\t"));
-    prettyPrintArray(powerPinIndex);
-    MS_DEEP_DBG(F("nMeasurementsOnPin:\t\t"));
-    prettyPrintArray(nMeasurementsOnPin);
-    MS_DEEP_DBG(F("powerPinIndex:\t\t\t"));
-    prettyPrintArray(powerPinIndex);
+    prettyPrintArray(&sensorWorkState::nCompleted);
+    MS_DEEP_DBG(F("powerPinGroup:\t\t\t"));
+    prettyPrintArray(_sensorPinGroup);
 #endif
 
-    // Another array for the number of measurements already completed per power
-    // pin
-    uint8_t nCompletedOnPin[_variableCount];
-    for (uint8_t i = 0; i < _variableCount; i++) { nCompletedOnPin[i] = 0; }
-
     // Clear the initial variable arrays
     MS_DBG(F("----->> Clearing all results arrays before taking new "
              "measurements. ..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            arrayOfVars[i]->parentSensor->clearValues();
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (_work[s].due) _sensorList[s]->clearValues();
     }
     MS_DBG(F("   ... Complete. <<-----"));
 
-    // power up all of the sensors together
-    MS_DBG(F("----->> Powering up all sensors together. ..."));
-    sensorsPowerUp();
+    // Put the sensors in order so the slowest ones are started first
+    MS_DBG(F("----->> Planning the sensor update order. ..."));
+    _predictedUpdateTime_ms = planUpdateOrder();
+    MS_DBG(F("   ... Complete. Predicted update time:"),
+           _predictedUpdateTime_ms, F("ms <<-----"));
+    uint32_t cycleStart    = millis();
+    uint32_t updateTimeout = _updateTimeout_ms;
+    if (updateTimeout == 0) {
+        updateTimeout = _predictedUpdateTime_ms + MS_UPDATE_TIMEOUT_MARGIN_MS;
+    }
+
+    // power up all of the due sensors together
+    MS_DBG(F("----->> Powering up all due sensors together. ..."));
+    for (uint8_t i = 0; i < _sensorCount; i++) {
+        uint8_t s = _sensorOrder[i];
+        if (_work[s].due) _sensorList[s]->powerUp();
+        _work[s].phaseStart   = millis();
+        _work[s].timeoutStart = _work[s].phaseStart;
+    }
     MS_DBG(F("   ... Complete. <<-----"));
 
     while (nSensorsCompleted < _sensorCount) {
-        for (uint8_t i = 0; i < _variableCount; i++) {
+        for (uint8_t b = 0; b < _busGroupCount; b++) {
+            _work[b].busUsed = false;
+        }
+        for (uint8_t i = 0; i < _sensorCount; i++) {
+            uint8_t s = _sensorOrder[i];
+            uint8_t b = _sensorBusGroup[s];
             /***
             // THIS IS PURELY FOR DEEP DEBUGGING OF THE TIMING!
             // Leave this whole section commented out unless you want excessive
             // printouts (ie, thousands of lines) of the timing information!!
-            if (lastSensorVariable[i] and
-                nMeasurementsToAverage[i] > nMeasurementsCompleted[i]) {
+            if (_work[s].nToAverage > _work[s].nCompleted) {
                 MS_DEEP_DBG(
-                    i, '-', arrayOfVars[i]->getParentSensorNameAndLocation(),
+                    s, '-', _sensorList[s]->getSensorNameAndLocation(),
                     F("- millis:"), millis(), F("- status: 0b"),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 7),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 6),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 5),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 4),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 2),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 1),
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 0),
-                    F("- measurement #"), (nMeasurementsCompleted[i] + 1));
+                    bitRead(_sensorList[s]->getStatus(), 7),
+                    bitRead(_sensorList[s]->getStatus(), 6),
+                    bitRead(_sensorList[s]->getStatus(), 5),
+                    bitRead(_sensorList[s]->getStatus(), 4),
+                    bitRead(_sensorList[s]->getStatus(), 3),
+                    bitRead(_sensorList[s]->getStatus(), 2),
+                    bitRead(_sensorList[s]->getStatus(), 1),
+                    bitRead(_sensorList[s]->getStatus(), 0),
+                    F("- measurement #"), (_work[s].nCompleted + 1));
             }
             MS_DEEP_DBG(F("----------------------------------"));
             MS_DEEP_DBG(F("nMeasurementsToAverage:\t\t"));
-            prettyPrintArray(nMeasurementsToAverage);
+            prettyPrintArray(&sensorWorkState::nToAverage);
             MS_DEEP_DBG(F("nMeasurementsCompleted:\t\t"));
-            prettyPrintArray(nMeasurementsCompleted);
-            MS_DEEP_DBG(F("nMeasurementsOnPin:\t\t"));
-            prettyPrintArray(nMeasurementsOnPin);
-            MS_DEEP_DBG(F("nCompletedOnPin:\t\t\t"));
-            prettyPrintArray(nCompletedOnPin);
+            prettyPrintArray(&sensorWorkState::nCompleted);
             // END CHUNK FOR DEBUGGING!
             ***/
 
             // Only do checks on sensors that still have measurements to finish
-            if (lastSensorVariable[i] &&
-                nMeasurementsToAverage[i] > nMeasurementsCompleted[i]) {
+            if (_work[s].nToAverage > _work[s].nCompleted) {
+                // Whether another sensor has already used the bus this pass
+                bool busTaken = _work[b].busUsed;
+
                 // If no attempts yet made to wake the sensor up
-                if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                    0) {
-                    // and if it is already warmed up
-                    if (arrayOfVars[i]->parentSensor->isWarmedUp(
-                            deepDebugTiming)) {
-                        MS_DBG(i, F("--->> Waking"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
+                if (bitRead(_sensorList[s]->getStatus(), 3) == 0) {
+                    // and if it is already warmed up and its bus is free
+                    if (!_work[b].busUsed &&
+                        _sensorList[s]->isWarmedUp(deepDebugTiming)) {
+                        MS_DBG(s, F("--->> Waking"),
+                               _sensorList[s]->getSensorNameAndLocation(),
                                F("..."));
 
                         // Make a single attempt to wake the sensor after it is
                         // warmed up
-                        bool sensorSuccess_wake =
-                            arrayOfVars[i]->parentSensor->wake();
+                        uint32_t wakeStart = millis();
+                        _sensorList[s]->recordPhaseTime(
+                            SENSOR_PHASE_WARM_UP,
+                            wakeStart - _work[s].phaseStart);
+                        bool sensorSuccess_wake = _sensorList[s]->wake();
                         success &= sensorSuccess_wake;
+                        _work[b].busUsed      = true;
+                        _work[s].phaseStart   = millis();
+                        _work[s].timeoutStart = _work[s].phaseStart;
+                        _sensorList[s]->recordPhaseTime(
+                            SENSOR_PHASE_WAKE, _work[s].phaseStart - wakeStart);
 
                         if (sensorSuccess_wake) {
-                            MS_DBG(F("   ... wake up uccess. <<---"), i);
+                            MS_DBG(F("   ... wake up uccess. <<---"), s);
                         } else {
-                            MS_DBG(F("   ... wake up failed! <<---"), i);
+                            MS_DBG(F("   ... wake up failed! <<---"), s);
                         }
                     }
                 }
@@ -731,52 +719,59 @@ bool VariableArray::completeUpdate(void) {
                 // If attempts were made to wake the sensor, but they failed
                 // then we're just bumping up the number of measurements to
                 // completion
-                if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                        1 &&
-                    bitRead(arrayOfVars[i]->parentSensor->getStatus(), 4) ==
-                        0) {
-                    MS_DBG(i, F("--->>"),
-                           arrayOfVars[i]->getParentSensorNameAndLocation(),
+                if (bitRead(_sensorList[s]->getStatus(), 3) == 1 &&
+                    bitRead(_sensorList[s]->getStatus(), 4) == 0) {
+                    MS_DBG(s, F("--->>"),
+                           _sensorList[s]->getSensorNameAndLocation(),
                            F("did not wake up! No measurements will be taken! "
                              "<<---"),
-                           i);
+                           s);
                     // Set the number of measurements already equal to whatever
                     // total number requested to ensure the sensor is skipped in
                     // further loops.
-                    nMeasurementsCompleted[i] = nMeasurementsToAverage[i];
+                    _work[s].nCompleted = _work[s].nToAverage;
                     // increment the number of measurements that the power pin
                     // has completed
-                    nCompletedOnPin[powerPinIndex[i]] +=
-                        nMeasurementsToAverage[i];
+                    _work[_sensorPinGroup[s]].nCompletedOnPin +=
+                        _work[s].nToAverage;
                 }
 
                 // If the sensor was successfully awoken/activated...
                 // .. make sure the sensor is stable
-                if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 4) ==
-                        1 &&
-                    arrayOfVars[i]->parentSensor->isStable(deepDebugTiming)) {
+                if (bitRead(_sensorList[s]->getStatus(), 4) == 1 &&
+                    _sensorList[s]->isStable(deepDebugTiming)) {
                     // If no attempt has yet been made to start a measurement,
-                    // start one
-                    if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 5) ==
-                        0) {
+                    // and the bus is free, start one
+                    if (bitRead(_sensorList[s]->getStatus(), 5) == 0 &&
+                        !_work[b].busUsed) {
                         // Start a reading
-                        MS_DBG(i, '.', nMeasurementsCompleted[i] + 1,
+                        MS_DBG(s, '.', _work[s].nCompleted + 1,
                                F("--->> Starting reading"),
-                               nMeasurementsCompleted[i] + 1, F("on"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
+                               _work[s].nCompleted + 1, F("on"),
+                               _sensorList[s]->getSensorNameAndLocation(),
                                F("..."));
 
+                        // Only the wait before the first measurement is
+                        // counted as stabilization
+                        uint32_t measurementStart = millis();
+                        if (_work[s].nCompleted == 0) {
+                            _sensorList[s]->recordPhaseTime(
+                                SENSOR_PHASE_STABILIZATION,
+                                measurementStart - _work[s].phaseStart);
+                        }
                         bool sensorSuccess_start =
-                            arrayOfVars[i]
-                                ->parentSensor->startSingleMeasurement();
+                            _sensorList[s]->startSingleMeasurement();
                         success &= sensorSuccess_start;
+                        _work[b].busUsed      = true;
+                        _work[s].phaseStart   = measurementStart;
+                        _work[s].timeoutStart = measurementStart;
 
                         if (sensorSuccess_start) {
-                            MS_DBG(F("   ... set up succeeded. <<---"), i, '.',
-                                   nMeasurementsCompleted[i] + 1);
+                            MS_DBG(F("   ... set up succeeded. <<---"), s, '.',
+                                   _work[s].nCompleted + 1);
                         } else {
-                            MS_DBG(F("   ... set up failed! <<---"), i, '.',
-                                   nMeasurementsCompleted[i] + 1);
+                            MS_DBG(F("   ... set up failed! <<---"), s, '.',
+                                   _work[s].nCompleted + 1);
                         }
                     }
 
@@ -786,67 +781,101 @@ bool VariableArray::completeUpdate(void) {
                     // isMeasurementComplete(deepDebugTiming) will do that and
                     // we stil want the addSingleMeasurementResult() function to
                     // fill in the -9999 results for a failed measurement.
-                    if (arrayOfVars[i]->parentSensor->isMeasurementComplete(
+                    if (!_work[b].busUsed &&
+                        _sensorList[s]->isMeasurementComplete(
                             deepDebugTiming)) {
                         // Get the value
-                        MS_DBG(i, '.', nMeasurementsCompleted[i] + 1,
+                        MS_DBG(s, '.', _work[s].nCompleted + 1,
                                F("--->> Collected result of reading"),
-                               nMeasurementsCompleted[i] + 1, F("from"),
-                               arrayOfVars[i]->getParentSensorNameAndLocation(),
+                               _work[s].nCompleted + 1, F("from"),
+                               _sensorList[s]->getSensorNameAndLocation(),
                                F("..."));
 
+                        uint32_t resultStart = millis();
+                        _sensorList[s]->recordPhaseTime(
+                            SENSOR_PHASE_MEASUREMENT,
+                            resultStart - _work[s].phaseStart);
                         bool sensorSuccess_result =
-                            arrayOfVars[i]
-                                ->parentSensor->addSingleMeasurementResult();
+                            _sensorList[s]->addSingleMeasurementResult();
                         success &= sensorSuccess_result;
-                        nMeasurementsCompleted[i] +=
+                        _work[b].busUsed      = true;
+                        _work[s].phaseStart   = millis();
+                        _work[s].timeoutStart = _work[s].phaseStart;
+                        _sensorList[s]->recordPhaseTime(
+                            SENSOR_PHASE_RESULT,
+                            _work[s].phaseStart - resultStart);
+                        _work[s].nCompleted +=
                             1;  // increment the number of measurements that
                                 // sensor has completed
-                        nCompletedOnPin[powerPinIndex[i]] +=
+                        _work[_sensorPinGroup[s]].nCompletedOnPin +=
                             1;  // increment the number of measurements that the
                                 // power pin has completed
 
                         if (sensorSuccess_result) {
-                            MS_DBG(F("   ... got measurement result. <<---"), i,
-                                   '.', nMeasurementsCompleted[i]);
+                            MS_DBG(F("   ... got measurement result. <<---"), s,
+                                   '.', _work[s].nCompleted);
                         } else {
                             MS_DBG(F("   ... failed to get measurement result! "
                                      "<<---"),
-                                   i, '.', nMeasurementsCompleted[i]);
+                                   s, '.', _work[s].nCompleted);
                         }
                     }
                 }
 
+                // A sensor that is ready for its next step but found its bus
+                // taken is only waiting its turn; that doesn't count against
+                // its phase timeout, so the timeout clock restarts.
+                if (busTaken && _sensorList[s]->getTimeUntilReady() == 0) {
+                    _work[s].timeoutStart = millis();
+                }
+
+                // Give up on the sensor if it has been stuck in one phase for
+                // too long or if the whole update is over its time budget.
+                // Any remaining measurements are counted as done so the sensor
+                // is put to sleep and powered down below.
+                if (_work[s].nCompleted < _work[s].nToAverage &&
+                    (millis() - _work[s].timeoutStart >
+                         _sensorList[s]->getPhaseTimeout() ||
+                     millis() - cycleStart > updateTimeout)) {
+                    PRINTOUT(F("Timed out waiting for"),
+                             _sensorList[s]->getSensorNameAndLocation(),
+                             F("- no values will be reported!"));
+                    _sensorList[s]->abortUpdate();
+                    success = false;
+                    _work[_sensorPinGroup[s]].nCompletedOnPin +=
+                        _work[s].nToAverage - _work[s].nCompleted;
+                    _work[s].nCompleted = _work[s].nToAverage;
+                }
+
                 // If all the measurements are done
-                if (nMeasurementsCompleted[i] == nMeasurementsToAverage[i]) {
-                    MS_DBG(i, F("--->> Finished all measurements from"),
-                           arrayOfVars[i]->getParentSensorNameAndLocation(),
+                if (_work[s].nCompleted == _work[s].nToAverage) {
+                    MS_DBG(s, F("--->> Finished all measurements from"),
+                           _sensorList[s]->getSensorNameAndLocation(),
                            F(", putting it to sleep. ..."));
 
                     // Put the completed sensor to sleep
-                    bool sensorSuccess_sleep =
-                        arrayOfVars[i]->parentSensor->sleep();
+                    bool sensorSuccess_sleep = _sensorList[s]->sleep();
                     success &= sensorSuccess_sleep;
+                    _work[b].busUsed = true;
 
                     if (sensorSuccess_sleep) {
                         MS_DBG(F("   ... succeeded in putting sensor to sleep. "
                                  "<<---"),
-                               i);
+                               s);
                     } else {
-                        MS_DBG(F("   ... sleep failed! <<---"), i);
+                        MS_DBG(F("   ... sleep failed! <<---"), s);
                     }
 
                     // Now cut the power, if ready, to this sensors and all that
                     // share the pin
-                    if (nCompletedOnPin[powerPinIndex[i]] ==
-                        nMeasurementsOnPin[powerPinIndex[i]]) {
-                        for (uint8_t k = 0; k < _variableCount; k++) {
-                            if (powerPinIndex[k] == powerPinIndex[i] &&
-                                lastSensorVariable[k]) {
-                                arrayOfVars[k]->parentSensor->powerDown();
+                    uint8_t g = _sensorPinGroup[s];
+                    if (_work[g].nCompletedOnPin == _work[g].nOnPin) {
+                        for (uint8_t k = 0; k < _sensorCount; k++) {
+                            if (_sensorPinGroup[k] == g) {
+                                _sensorList[k]->powerDown();
                                 MS_DBG(k, F("--->>"),
-                                       arrayOfVars[k]
-                                           ->getParentSensorNameAndLocation(),
+                                       _sensorList[k]
+                                           ->getSensorNameAndLocation(),
                                        F("powered down. <<---"), k);
                             }
                         }
@@ -858,36 +887,113 @@ bool VariableArray::completeUpdate(void) {
                 }
             }
         }
+
+        // Idle until the next sensor is ready for its next step
+        idleUntilNextEvent();
     }
 
     // Average measurements and notify varibles of the updates
     MS_DBG(F("----->> Averaging results and notifying all variables. ..."));
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (lastSensorVariable[i]) {
-            MS_DBG(F("--- Averaging results from"),
-                   arrayOfVars[i]->getParentSensorNameAndLocation(), F("---"));
-            arrayOfVars[i]->parentSensor->averageMeasurements();
-            MS_DBG(F("--- Notifying variables from"),
-                   arrayOfVars[i]->getParentSensorNameAndLocation(), F("---"));
-            arrayOfVars[i]->parentSensor->notifyVariables();
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (!_work[s].due) continue;
+        MS_DBG(F("--- Averaging results from"),
+               _sensorList[s]->getSensorNameAndLocation(), F("---"));
+        _sensorList[s]->averageMeasurements();
+        MS_DBG(F("--- Notifying variables from"),
+               _sensorList[s]->getSensorNameAndLocation(), F("---"));
+        _sensorList[s]->notifyVariables();
     }
     MS_DBG(F("... Complete. <<-----"));
 
+    // Keep the values and value strings for the CSV file and publishers.
+    // Measured variables of sensors that were updated have already dropped
+    // their snapshots; the calculated variables are calculated again, once
+    // each, in the order of their inputs.
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (arrayOfVars[i]->isCalculated) arrayOfVars[i]->clearSnapshot();
+    }
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (!arrayOfVars[i]->hasSnapshot()) arrayOfVars[i]->takeSnapshot();
+    }
+
+    _lastUpdateTime_ms = millis() - cycleStart;
+    MS_DBG(F("Update took"), _lastUpdateTime_ms, F("ms; predicted"),
+           _predictedUpdateTime_ms, F("ms."));
+
+    _work = NULL;
     return success;
 }
 
 
+// These return the predicted and actual times of the last complete update
+uint32_t VariableArray::getPredictedUpdateTime(void) {
+    return _predictedUpdateTime_ms;
+}
+uint32_t VariableArray::getLastUpdateTime(void) {
+    return _lastUpdateTime_ms;
+}
+
+
+// This sets the time budget for a complete update
+void VariableArray::setUpdateTimeout(uint32_t timeout_ms) {
+    _updateTimeout_ms = timeout_ms;
+}
+
+
+// These save and restore the learned warm-up times, marked with a signature
+// byte and the number of sensors so a different setup isn't given the wrong
+// times
+#define WARM_UP_EEPROM_SIGNATURE 0x57
+bool VariableArray::saveWarmUpTimes(int eepromAddress) {
+#if defined(ARDUINO_ARCH_AVR) || defined(__AVR__)
+    EEPROM.update(eepromAddress, WARM_UP_EEPROM_SIGNATURE);
+    EEPROM.update(eepromAddress + 1, _sensorCount);
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        EEPROM.put(eepromAddress + 2 + s * sizeof(uint32_t),
+                   _sensorList[s]->getLearnedWarmUpTime());
+    }
+    MS_DBG(F("Saved the learned warm-up times of"), _sensorCount,
+           F("sensors"));
+    return true;
+#else
+    (void)eepromAddress;
+    MS_DBG(F("There is no EEPROM to save the learned warm-up times in"));
+    return false;
+#endif
+}
+bool VariableArray::loadWarmUpTimes(int eepromAddress) {
+#if defined(ARDUINO_ARCH_AVR) || defined(__AVR__)
+    if (EEPROM.read(eepromAddress) != WARM_UP_EEPROM_SIGNATURE ||
+        EEPROM.read(eepromAddress + 1) != _sensorCount) {
+        MS_DBG(F("No saved warm-up times for this set of sensors"));
+        return false;
+    }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (!_sensorList[s]->isAdaptiveWarmUp()) continue;
+        uint32_t learned;
+        EEPROM.get(eepromAddress + 2 + s * sizeof(uint32_t), learned);
+        _sensorList[s]->setLearnedWarmUpTime(learned);
+        MS_DBG(F("Restored a warm-up time of"), learned, F("ms for"),
+               _sensorList[s]->getSensorNameAndLocation());
+    }
+    return true;
+#else
+    (void)eepromAddress;
+    return false;
+#endif
+}
+
+
 // This function prints out the results for any connected sensors to a stream
 //  Calculated Variable results will be included
 void VariableArray::printSensorData(Stream* stream) {
     for (uint8_t i = 0; i < _variableCount; i++) {
         if (arrayOfVars[i]->isCalculated) {
-            stream->print(arrayOfVars[i]->getVarName());
+            arrayOfVars[i]->printVarName(stream);
             stream->print(F(" is calculated to be "));
             stream->print(arrayOfVars[i]->getValueString());
             stream->print(F(" "));
-            stream->print(arrayOfVars[i]->getVarUnit());
+            arrayOfVars[i]->printVarUnit(stream);
             stream->println();
         } else {
             stream->print(arrayOfVars[i]->getParentSensorNameAndLocation());
@@ -909,42 +1015,165 @@ void VariableArray::printSensorData(Stream* stream) {
             // stream->print(
             //     bitRead(arrayOfVars[i]->parentSensor->getStatus(), 0));
             stream->print(F(" reports "));
-            stream->print(arrayOfVars[i]->getVarName());
+            arrayOfVars[i]->printVarName(stream);
             stream->print(F(" is "));
             stream->print(arrayOfVars[i]->getValueString());
             stream->print(F(" "));
-            stream->print(arrayOfVars[i]->getVarUnit());
+            arrayOfVars[i]->printVarUnit(stream);
             stream->println();
         }
     }
 }
 
 
-// Check for unique sensors
-bool VariableArray::isLastVarFromSensor(int arrayIndex) {
-    /*MS_DEEP_DBG(F("Checking if"), arrayOfVars[arrayIndex]->getVarName(), '(',
-           arrayIndex, F(") is the last variable from a sensor..."));*/
+// This prints the timing profile of each sensor as CSV, with one row for each
+// phase of each sensor
+void VariableArray::printSensorTiming(Stream* stream) {
+    stream->println(F("Sensor,Phase,Count,Min(ms),Mean(ms),Max(ms)"));
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        for (uint8_t p = 0; p < SENSOR_PHASE_COUNT; p++) {
+            sensorPhase phase = static_cast<sensorPhase>(p);
+            stream->print(_sensorList[s]->getSensorNameAndLocation());
+            stream->print(',');
+            stream->print(Sensor::getPhaseName(phase));
+            stream->print(',');
+            stream->print(_sensorList[s]->getPhaseCount(phase));
+            stream->print(',');
+            stream->print(_sensorList[s]->getPhaseMin(phase), 0);
+            stream->print(',');
+            stream->print(_sensorList[s]->getPhaseMean(phase), 1);
+            stream->print(',');
+            stream->println(_sensorList[s]->getPhaseMax(phase), 0);
+        }
+    }
+}
 
-    //  Calculated Variables are never the last variable from a sensor, simply
-    // because the don't come from a sensor at all.
-    if (arrayOfVars[arrayIndex]->isCalculated) {
-        // MS_DEEP_DBG(F("   ... Nope, it's calculated!"));
-        return false;
-    } else {
-        String sensNameLoc =
-            arrayOfVars[arrayIndex]->getParentSensorNameAndLocation();
-        bool unique = true;
-        for (uint8_t j = arrayIndex + 1; j < _variableCount; j++) {
-            if (sensNameLoc ==
-                arrayOfVars[j]->getParentSensorNameAndLocation()) {
-                unique = false;
-                // MS_DEEP_DBG(F("   ... Nope, there are others after it!"));
+
+// Build the list of unique sensors and their power pin groups
+// Sensors are matched by the identity of the parent sensor object, not by name.
+void VariableArray::buildSensorTables(void) {
+    _sensorCount   = 0;
+    _pinGroupCount = 0;
+    _busGroupCount = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        //  Calculated Variables are never the last variable from a sensor,
+        //  simply because the don't come from a sensor at all.
+        Sensor* sensor = arrayOfVars[i]->parentSensor;
+        if (arrayOfVars[i]->isCalculated || sensor == NULL) continue;
+
+        // Only the last variable from each sensor is used to list the sensor
+        bool isLast = true;
+        for (uint8_t j = i + 1; j < _variableCount; j++) {
+            if (!arrayOfVars[j]->isCalculated &&
+                arrayOfVars[j]->parentSensor == sensor) {
+                isLast = false;
+                break;
+            }
+        }
+        if (!isLast) continue;
+
+        if (_sensorCount >= MAX_NUMBER_SENSORS) {
+            PRINTOUT(F("Too many sensors in the variable array!"),
+                     sensor->getSensorNameAndLocation(),
+                     F("will not be updated!"));
+            continue;
+        }
+
+        // Find the group of other sensors sharing the same power pin
+        uint8_t group = _pinGroupCount;
+        for (uint8_t k = 0; k < _sensorCount; k++) {
+            if (_sensorList[k]->getPowerPin() == sensor->getPowerPin()) {
+                group = _sensorPinGroup[k];
                 break;
             }
         }
-        // if (unique) MS_DEEP_DBG(F("   ... Yes, it is!"));
-        return unique;
+        if (group == _pinGroupCount) _pinGroupCount++;
+
+        // Find the group of other sensors sharing the same communication bus
+        uint8_t busGroup = _busGroupCount;
+        if (sensor->getBusType() != SENSOR_BUS_NONE) {
+            for (uint8_t k = 0; k < _sensorCount; k++) {
+                if (_sensorList[k]->getBusType() == sensor->getBusType() &&
+                    _sensorList[k]->getBusId() == sensor->getBusId()) {
+                    busGroup = _sensorBusGroup[k];
+                    break;
+                }
+            }
+        }
+        if (busGroup == _busGroupCount) _busGroupCount++;
+
+        _sensorList[_sensorCount]     = sensor;
+        _sensorVarIndex[_sensorCount] = i;
+        _sensorPinGroup[_sensorCount] = group;
+        _sensorBusGroup[_sensorCount] = busGroup;
+        _sensorOrder[_sensorCount]    = _sensorCount;
+        _sensorCount++;
     }
+    // MS_DBG(F("There are"), _sensorCount, F("unique sensors on"),
+    //        _pinGroupCount, F("power pins in the group."));
+}
+
+
+// Sort the sensors into critical-path order and return the predicted update
+// time.  All of the sensors on a power pin stay powered until the slowest of
+// them is finished, so each group is ranked by its slowest sensor, keeping the
+// groups together, and then sensors are ranked within the group.  The number
+// of measurements to average is re-read because it may have changed since
+// begin().  Sensors that aren't due are given no time and sorted last.
+// Sensors on a shared bus take turns, so the predicted time is the longest
+// sum of the expected times of the sensors on one bus.  That is never less
+// than the slowest sensor of any power pin group, and it errs long when
+// sensors on a bus wait at the same time.
+uint32_t VariableArray::planUpdateOrder(void) {
+    for (uint8_t g = 0; g < _pinGroupCount; g++) { _work[g].groupTime = 0; }
+    for (uint8_t b = 0; b < _busGroupCount; b++) { _work[b].busTime = 0; }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        _work[s].sensorTime = 0;
+        if (_work[s].due) {
+            _work[s].sensorTime = _sensorList[s]->getExpectedUpdateTime();
+        }
+        uint8_t g          = _sensorPinGroup[s];
+        _work[g].groupTime = max(_work[g].groupTime, _work[s].sensorTime);
+        _work[_sensorBusGroup[s]].busTime += _work[s].sensorTime;
+        _sensorOrder[s] = s;
+    }
+
+    // A simple insertion sort - there are never very many sensors
+    for (uint8_t i = 1; i < _sensorCount; i++) {
+        uint8_t  s      = _sensorOrder[i];
+        uint32_t sGroup = _work[_sensorPinGroup[s]].groupTime;
+        uint8_t  j      = i;
+        while (j > 0) {
+            uint8_t  prev      = _sensorOrder[j - 1];
+            uint32_t prevGroup = _work[_sensorPinGroup[prev]].groupTime;
+            // Slower groups first, then keep groups together, then slower
+            // sensors first
+            if (sGroup < prevGroup) break;
+            if (sGroup == prevGroup) {
+                if (_sensorPinGroup[s] > _sensorPinGroup[prev]) break;
+                if (_sensorPinGroup[s] == _sensorPinGroup[prev] &&
+                    _work[s].sensorTime <= _work[prev].sensorTime)
+                    break;
+            }
+            _sensorOrder[j] = prev;
+            j--;
+        }
+        _sensorOrder[j] = s;
+    }
+
+    uint32_t predicted = 0;
+    for (uint8_t b = 0; b < _busGroupCount; b++) {
+        predicted = max(predicted, _work[b].busTime);
+    }
+
+#ifdef MS_VARIABLEARRAY_DEBUG_DEEP
+    MS_DEEP_DBG(F("expectedUpdateTime:\t\t"));
+    prettyPrintArray(&sensorWorkState::sensorTime);
+    MS_DEEP_DBG(F("updateOrder:\t\t\t"));
+    prettyPrintArray(_sensorOrder);
+#endif
+
+    return predicted;
 }
 
 
@@ -952,12 +1181,9 @@ bool VariableArray::isLastVarFromSensor(int arrayIndex) {
 // requested averaging
 uint8_t VariableArray::countMaxToAverage(void) {
     uint8_t numReps = 0;
-    for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            numReps = max(
-                numReps,
-                arrayOfVars[i]->parentSensor->getNumberMeasurementsToAverage());
-        }
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        numReps = max(numReps,
+                      _sensorList[s]->getNumberMeasurementsToAverage());
     }
     // MS_DBG(F("The largest number of measurements to average will be"),
     // numReps);
@@ -965,6 +1191,47 @@ uint8_t VariableArray::countMaxToAverage(void) {
 }
 
 
+// This puts the processor into an idle sleep until the first of the unfinished
+// sensors will be ready for its next step.  Timer interrupts (the millis()
+// timer on AVR, SysTick on SAMD) continue in the idle mode and wake the
+// processor, as do any other interrupts - like serial data from a sensor.
+// If any unfinished sensor is already ready, this returns immediately.
+void VariableArray::idleUntilNextEvent(void) {
+    bool     anyWaiting  = false;
+    uint32_t idleTime_ms = 0;
+    for (uint8_t s = 0; s < _sensorCount; s++) {
+        if (_work[s].nToAverage > _work[s].nCompleted) {
+            uint32_t wait_ms = _sensorList[s]->getTimeUntilReady();
+            if (wait_ms == 0) return;
+            if (!anyWaiting || wait_ms < idleTime_ms) {
+                idleTime_ms = wait_ms;
+                anyWaiting  = true;
+            }
+        }
+    }
+    if (!anyWaiting) return;
+
+    MS_DEEP_DBG(F("Idling for"), idleTime_ms,
+                F("ms until the next sensor is ready."));
+    uint32_t start = millis();
+#if defined(ARDUINO_ARCH_AVR) || defined(__AVR__)
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    while (millis() - start < idleTime_ms) { sleep_mode(); }
+#elif defined(ARDUINO_ARCH_SAMD)
+    // Make sure the deep sleep bit (set by the logger's systemSleep) is
+    // cleared so the SysTick will continue running
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+    while (millis() - start < idleTime_ms) {
+        __DSB();
+        __WFI();
+    }
+#else
+    // Let any background tasks of the core run while waiting
+    while (millis() - start < idleTime_ms) { yield(); }
+#endif
+}
+
+
 // Check that all variable have valid UUID's, if they are assigned
 bool VariableArray::checkVariableUUIDs(void) {
     bool success = true;
@@ -973,8 +1240,13 @@ bool VariableArray::checkVariableUUIDs(void) {
             PRINTOUT(arrayOfVars[i]->getVarCode(), F("has an invalid UUID!"));
             success = false;
         }
+        // Only UUIDs with the same hash need their bytes compared
+        uint16_t hash = arrayOfVars[i]->getVarUUIDHash();
+        if (hash == 0) continue;
         for (uint8_t j = i + 1; j < _variableCount; j++) {
-            if (arrayOfVars[i]->getVarUUID() == arrayOfVars[j]->getVarUUID()) {
+            if (arrayOfVars[j]->getVarUUIDHash() == hash &&
+                memcmp(arrayOfVars[i]->getVarUUIDBytes(),
+                       arrayOfVars[j]->getVarUUIDBytes(), 16) == 0) {
                 PRINTOUT(arrayOfVars[i]->getVarCode(),
                          F("has a non-unique UUID!"));
                 success = false;
@@ -986,9 +1258,10 @@ bool VariableArray::checkVariableUUIDs(void) {
     if (success)
         PRINTOUT(F("All variable UUID's appear to be correctly formed.\n"));
     // Print out all UUID's to check
+    char uuidText[37];
     for (uint8_t i = 0; i < _variableCount; i++) {
-        PRINTOUT(arrayOfVars[i]->getVarUUID(), F("->"),
-                 arrayOfVars[i]->getVarCode());
+        arrayOfVars[i]->getVarUUIDText(uuidText, sizeof(uuidText));
+        PRINTOUT(uuidText, F("->"), arrayOfVars[i]->getVarCode());
     }
     PRINTOUT(' ');
     return success;
@@ -32,6 +32,119 @@
 #include "VariableBase.h"
 #include "SensorBase.h"
 
+// Bring in the libraries to handle the processor idle mode and the EEPROM
+#if defined(ARDUINO_ARCH_AVR) || defined(__AVR__)
+#include <avr/sleep.h>
+#include <EEPROM.h>
+#endif
+
+/**
+ * @brief The largest number of unique sensors that can be attached to the
+ * variables in a single VariableArray.
+ *
+ * Override this with a build flag if you have more sensors than this, or to
+ * save RAM if you have fewer.  Every variable array keeps 6 bytes (8 on SAMD
+ * boards) of sensor tables per sensor allowed.  This also bounds the working
+ * state an update puts on the stack; see #sensorWorkState.
+ */
+#ifndef MAX_NUMBER_SENSORS
+#define MAX_NUMBER_SENSORS 20
+#endif
+
+/**
+ * @brief The extra time, beyond the predicted update time, that
+ * VariableArray::completeUpdate() may take before it gives up on any sensors
+ * that aren't finished.
+ *
+ * This is only used if no update timeout has been set with
+ * VariableArray::setUpdateTimeout().
+ */
+#ifndef MS_UPDATE_TIMEOUT_MARGIN_MS
+#define MS_UPDATE_TIMEOUT_MARGIN_MS 30000L
+#endif
+
+/**
+ * @brief The first EEPROM address used by VariableArray::saveWarmUpTimes()
+ * and VariableArray::loadWarmUpTimes().
+ *
+ * The learned warm-up times take 2 bytes plus 4 bytes per sensor.  Override
+ * this with a build flag if the program keeps something else there.
+ */
+#ifndef MS_WARM_UP_EEPROM_ADDRESS
+#define MS_WARM_UP_EEPROM_ADDRESS 0
+#endif
+
+
+/**
+ * @brief The working state of one sensor during an update.
+ *
+ * Entry `i` of the block also holds the state of power pin group `i` and bus
+ * group `i`; there can never be more groups than sensors.  The block is made
+ * on the stack, one entry per sensor attached, by each of
+ * VariableArray::setupSensors(), VariableArray::updateAllSensors(), and
+ * VariableArray::completeUpdate() and is gone once they return.  The stack it
+ * takes is bounded by #MAX_NUMBER_SENSORS.
+ */
+typedef struct sensorWorkState {
+    /**
+     * @brief The number of measurements to average from the sensor in this
+     * update; 0 if the sensor is not due.
+     */
+    uint8_t nToAverage;
+    /**
+     * @brief The number of measurements already completed by the sensor.
+     */
+    uint8_t nCompleted;
+    /**
+     * @brief Whether the sensor is due to be sampled in this update.
+     */
+    bool due;
+    /**
+     * @brief Whether the sensor was powered by setupSensors() and needs to be
+     * powered down again when the set up is finished.
+     */
+    bool poweredForSetup;
+    /**
+     * @brief The number of measurements to take from all of the sensors on
+     * the power pin group.
+     */
+    uint8_t nOnPin;
+    /**
+     * @brief The number of measurements completed by all of the sensors on
+     * the power pin group.
+     */
+    uint8_t nCompletedOnPin;
+    /**
+     * @brief Whether the bus group has been used in the current pass through
+     * the sensors.
+     */
+    bool busUsed;
+    /**
+     * @brief The millis() at the start of the sensor's current update phase.
+     */
+    uint32_t phaseStart;
+    /**
+     * @brief The millis() the phase timeout counts from; the start of the
+     * phase, moved forward while the sensor is ready but waiting for another
+     * sensor to free its bus.
+     */
+    uint32_t timeoutStart;
+    /**
+     * @brief The expected update time of the sensor in ms, for ordering.
+     */
+    uint32_t sensorTime;
+    /**
+     * @brief The expected update time of the power pin group in ms, for
+     * ordering.
+     */
+    uint32_t groupTime;
+    /**
+     * @brief The summed expected update time of the sensors on the bus group
+     * in ms, since they take turns on the bus.
+     */
+    uint32_t busTime;
+} sensorWorkState;
+
 
 /**
  * @brief The variable array class defines the logic for iterating through many
@@ -57,6 +170,9 @@
  * the amount of time that all sensors are powered and the processor is awake.
  * That is, the first sensor to be warmed up will be set up or activated first;
  * the first sensor to stabilize will be asked for values first.
+ * Whenever none of the sensors are ready for their next step, the processor is
+ * put into a light "idle" sleep until the earliest time any sensor will be
+ * ready, rather than being kept fully awake checking sensor timing.
  * All calculations for any calculated variables happen after all the sensor
  * updating has finished.
  * The order of the variables within the array should not matter, though for
@@ -169,6 +285,8 @@ class VariableArray {
      * This will often be different from the number of variables because many
      * sensors can return multiple variables.
      *
+     * @note The sensors are only counted when the array is created or begun.
+     *
      * @return **uint8_t** The number of sensors
      */
     uint8_t getSensorCount(void);
@@ -193,6 +311,13 @@ class VariableArray {
      * respond to its setup command, the command is called 5 times in attempt to
      * make a connection.  If all sensors are set up successfully, returns true.
      *
+     * All of the sensors that still need to be set up are powered at once and
+     * each is set up as soon as it has warmed up, so the set up only takes as
+     * long as the slowest sensor instead of the sum of all of their warm-up
+     * times.  Any power that was turned on for the set up is turned off again
+     * at the end.  To set the sensors up one at a time, each powering itself
+     * as needed, define the build flag `MS_SERIAL_SENSOR_SETUP`.
+     *
      * @return **bool** True indicates all sensors have been set up
      * successfully.
      */
@@ -237,6 +362,10 @@ class VariableArray {
      * overall success.  Does NOT return any values.  Repeatedly checks each
      * sensor's readiness state to optimize timing.
      *
+     * Sensors on different communication buses are serviced independently,
+     * while sensors that share a bus take turns, with at most one transaction
+     * per bus in each pass through the sensors.
+     *
      * @return **bool** True if all steps of the update succeeded.
      */
     bool updateAllSensors(void);
@@ -249,11 +378,93 @@ class VariableArray {
      *
      * Returns a boolean indication the overall success.  Does NOT return any
      * values.  Repeatedly checks each sensor's readiness state to optimize
-     * timing.
+     * timing.  As in updateAllSensors(), sensors sharing a communication bus
+     * take turns, but sensors on different buses are serviced independently.
+     *
+     * Before powering anything, the sensors are put in critical-path order:
+     * the power pin groups with the longest expected update time (warm-up +
+     * stabilization + measurements to average x measurement time) go first,
+     * and within a group the slowest sensor goes first.  This way the whole
+     * cycle should finish in about the time needed by the busiest bus, which
+     * is the sum of the times of the sensors taking turns on it.
+     *
+     * Each call counts as one update cycle; sensors are only sampled in the
+     * cycles that are a multiple of their sampling interval - see
+     * Sensor::setSamplingInterval().  Sensors that are not due are not powered
+     * at all and their last values are carried forward and flagged as stale.
      *
      * @return **bool** True if all steps of the update succeeded.
      */
     bool completeUpdate(void);
+    /**
+     * @brief Update the values for all connected sensors that are due in the
+     * given update cycle, including powering them and waking and putting them
+     * to sleep.
+     *
+     * @param updateCycle The number of the update cycle.  The logger uses the
+     * number of logging intervals since the epoch so that sensors with longer
+     * sampling intervals are always sampled at the same clock times.
+     * @return **bool** True if all steps of the update succeeded.
+     */
+    bool completeUpdate(uint32_t updateCycle);
+
+    /**
+     * @brief Get the predicted duration of the most recent completeUpdate()
+     *
+     * Sensors sharing a bus take turns on it, so this is the longest sum of
+     * the expected update times of the sensors on one bus; a sensor with a
+     * bus of its own counts alone.
+     *
+     * @return **uint32_t** The predicted update time in milliseconds.
+     */
+    uint32_t getPredictedUpdateTime(void);
+    /**
+     * @brief Get the actual duration of the most recent completeUpdate()
+     *
+     * @return **uint32_t** The measured update time in milliseconds.
+     */
+    uint32_t getLastUpdateTime(void);
+
+    /**
+     * @brief Set the total time budget for completeUpdate().
+     *
+     * Once the budget is spent, any sensors that haven't finished are given
+     * up on: their values are set to -9999 and they are put to sleep and
+     * powered down so that the rest of the data can still be logged.  A single
+     * sensor is also given up on if it is stuck in one phase of the update for
+     * longer than Sensor::getPhaseTimeout(); time it spends ready but waiting
+     * for another sensor to free a shared bus doesn't count.
+     *
+     * @param timeout_ms The time budget in milliseconds.  Use 0 (the default)
+     * to allow the predicted update time plus #MS_UPDATE_TIMEOUT_MARGIN_MS.
+     */
+    void setUpdateTimeout(uint32_t timeout_ms);
+
+    /**
+     * @brief Save the learned warm-up times of the sensors to EEPROM so they
+     * can be restored with loadWarmUpTimes() after a reset.
+     *
+     * Only bytes that have changed are written, but EEPROM still wears out
+     * after about 100,000 writes, so this should be called now and then (ie,
+     * once a day) rather than after every update.  See
+     * Sensor::setAdaptiveWarmUp().
+     *
+     * @param eepromAddress The first EEPROM address to use.
+     * @return **bool** True if the times were saved; always false on boards
+     * without EEPROM.
+     */
+    bool saveWarmUpTimes(int eepromAddress = MS_WARM_UP_EEPROM_ADDRESS);
+    /**
+     * @brief Restore the learned warm-up times saved by saveWarmUpTimes().
+     *
+     * Nothing is restored if the saved times are for a different number of
+     * sensors.  The times are only given to sensors with an adaptive warm-up,
+     * so setAdaptiveWarmUp() must be called first.
+     *
+     * @param eepromAddress The first EEPROM address to use.
+     * @return **bool** True if the times were restored.
+     */
+    bool loadWarmUpTimes(int eepromAddress = MS_WARM_UP_EEPROM_ADDRESS);
 
     /**
      * @brief Print out the results for all connected sensors to a stream
@@ -268,6 +479,21 @@ class VariableArray {
      */
     void printSensorData(Stream* stream = &Serial);
 
+    /**
+     * @brief Print out the timing profile of each sensor as comma separated
+     * values.
+     *
+     * Each row gives the number of recorded durations and the minimum, mean,
+     * and maximum duration in milliseconds of one update phase of one sensor.
+     * The timing profiles are only recorded by completeUpdate() and only if
+     * MS_CHECK_SENSOR_TIMING is defined as a build flag.  They're meant to
+     * help tune the warm-up, stabilization, and measurement times of the
+     * sensors.
+     *
+     * @param stream An Arduino Stream instance
+     */
+    void printSensorTiming(Stream* stream = &Serial);
+
  protected:
     /**
      * @brief The count of variables in the array
@@ -282,15 +508,87 @@ class VariableArray {
      */
     uint8_t _maxSamplestoAverage;
 
+    /**
+     * @brief The unique sensors tied to variables in the array.
+     *
+     * The sensors are listed in the order of the *last* variable from each
+     * sensor in the array.  Calculated variables have no sensor and are not
+     * included.  This is built once in begin() so that none of the update
+     * functions need to search through the variables to find unique sensors.
+     */
+    Sensor* _sensorList[MAX_NUMBER_SENSORS];
+    /**
+     * @brief The position in the variable array of the last variable from each
+     * sensor in the #_sensorList.
+     */
+    uint8_t _sensorVarIndex[MAX_NUMBER_SENSORS];
+    /**
+     * @brief The power pin group of each sensor in the #_sensorList.
+     *
+     * All sensors sharing a power pin are in the same group, and power to that
+     * pin is only cut after every sensor in the group has finished measuring.
+     */
+    uint8_t _sensorPinGroup[MAX_NUMBER_SENSORS];
+    /**
+     * @brief The number of unique power pins used by the sensors in the array.
+     */
+    uint8_t _pinGroupCount;
+    /**
+     * @brief The communication bus group of each sensor in the #_sensorList.
+     *
+     * All sensors sharing a bus (the same bus type and identity) are in the
+     * same group.  Only one sensor in a group talks on the bus in each pass
+     * through the update loop, so a sensor on one bus is never held up by a
+     * run of transactions on another bus.  Every sensor without a shared bus
+     * is in a group of its own.
+     */
+    uint8_t _sensorBusGroup[MAX_NUMBER_SENSORS];
+    /**
+     * @brief The number of bus groups used by the sensors in the array.
+     */
+    uint8_t _busGroupCount;
+    /**
+     * @brief The order in which to step through the #_sensorList when powering
+     * and updating the sensors.
+     *
+     * This is set to critical-path order (slowest first) at the start of
+     * each completeUpdate().
+     */
+    uint8_t _sensorOrder[MAX_NUMBER_SENSORS];
+    /**
+     * @brief The number of the next update cycle for completeUpdate(void).
+     */
+    uint32_t _updateCycle;
+    /**
+     * @brief The predicted duration in ms of the last completeUpdate().
+     */
+    uint32_t _predictedUpdateTime_ms;
+    /**
+     * @brief The actual duration in ms of the last completeUpdate().
+     */
+    uint32_t _lastUpdateTime_ms;
+    /**
+     * @brief The time budget in ms for completeUpdate(); 0 for automatic.
+     */
+    uint32_t _updateTimeout_ms;
+
+    /**
+     * @brief The working state of the update that is running, one entry per
+     * sensor; NULL between updates.
+     */
+    sensorWorkState* _work;
+
  private:
-    bool    isLastVarFromSensor(int arrayIndex);
-    uint8_t countMaxToAverage(void);
-    bool    checkVariableUUIDs(void);
+    void     buildSensorTables(void);
+    uint8_t  countMaxToAverage(void);
+    uint32_t planUpdateOrder(void);
+    void     idleUntilNextEvent(void);
+    bool     checkVariableUUIDs(void);
 
 #ifdef MS_VARIABLEARRAY_DEBUG_DEEP
     /**
-     * @brief Prints out the contents of an array with even spaces and commas
-     * between the members
+     * @brief Prints out the contents of a per-sensor array with even spaces
+     * and commas between the members
      *
      * @tparam T Any printable type
      * @param arrayToPrint The array of values to print.
@@ -298,12 +596,28 @@ class VariableArray {
     template <typename T>
     void prettyPrintArray(T arrayToPrint[]) {
         DEEP_DEBUGGING_SERIAL_OUTPUT.print("[,\t");
-        for (uint8_t i = 0; i < _variableCount; i++) {
+        for (uint8_t i = 0; i < _sensorCount; i++) {
             DEEP_DEBUGGING_SERIAL_OUTPUT.print(arrayToPrint[i]);
             DEEP_DEBUGGING_SERIAL_OUTPUT.print(",\t");
         }
         DEEP_DEBUGGING_SERIAL_OUTPUT.println("]");
     }
+    /**
+     * @brief Prints out one member of the working state of each sensor with
+     * even spaces and commas between them
+     *
+     * @tparam T Any printable type
+     * @param member The member of #sensorWorkState to print.
+     */
+    template <typename T>
+    void prettyPrintArray(T sensorWorkState::*member) {
+        DEEP_DEBUGGING_SERIAL_OUTPUT.print("[,\t");
+        for (uint8_t i = 0; i < _sensorCount; i++) {
+            DEEP_DEBUGGING_SERIAL_OUTPUT.print(_work[i].*member);
+            DEEP_DEBUGGING_SERIAL_OUTPUT.print(",\t");
+        }
+        DEEP_DEBUGGING_SERIAL_OUTPUT.println("]");
+    }
 #else
 /**
  * @brief Prints out the contents of an array with even spaces and commas
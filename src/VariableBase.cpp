@@ -10,6 +10,15 @@
 #include "VariableBase.h"
 #include "SensorBase.h"
 
+// The results of reading a UUID into its bytes
+enum uuidStatus {
+    UUID_NOT_SET = 0,
+    UUID_OK,
+    UUID_BAD_LENGTH,
+    UUID_BAD_DASHES,
+    UUID_BAD_CHARACTER
+};
+
 // ============================================================================
 //  The class and functions for interfacing with a specific variable.
 // ============================================================================
@@ -20,6 +29,7 @@ Variable::Variable(Sensor* parentSense, const uint8_t sensorVarNum,
                    uint8_t decimalResolution, const char* varName,
                    const char* varUnit, const char* varCode, const char* uuid)
     : _sensorVarNum(sensorVarNum) {
+    _flashMetadata = NULL;
     setVarUUID(uuid);
     setVarCode(varCode);
     setVarUnit(varUnit);
@@ -32,7 +42,11 @@ Variable::Variable(Sensor* parentSense, const uint8_t sensorVarNum,
 
     // When we create the variable, we also want to initialize it with a current
     // value of -9999 (ie, a bad result).
-    _currentValue = -9999;
+    _currentValue       = -9999;
+    _calcInputs         = NULL;
+    _calcInputCount     = 0;
+    _snapshotTaken      = false;
+    _snapshotInProgress = false;
 
     // MS_DBG(F("Measured Variable object created"));
 }
@@ -40,7 +54,8 @@ Variable::Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode)
     : _sensorVarNum(sensorVarNum) {
-    _uuid = NULL;
+    _flashMetadata = NULL;
+    setVarUUID(NULL);
     setVarCode(varCode);
     setVarUnit(varUnit);
     setVarName(varName);
@@ -52,7 +67,11 @@ Variable::Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
 
     // When we create the variable, we also want to initialize it with a current
     // value of -9999 (ie, a bad result).
-    _currentValue = -9999;
+    _currentValue       = -9999;
+    _calcInputs         = NULL;
+    _calcInputCount     = 0;
+    _snapshotTaken      = false;
+    _snapshotInProgress = false;
 
     // MS_DBG(F("Measured Variable object created"));
 }
@@ -64,6 +83,7 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode, const char* uuid)
     : _sensorVarNum(0) {
+    _flashMetadata = NULL;
     setVarUUID(uuid);
     setVarCode(varCode);
     setVarUnit(varUnit);
@@ -76,7 +96,11 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
 
     // When we create the variable, we also want to initialize it with a current
     // value of -9999 (ie, a bad result).
-    _currentValue = -9999;
+    _currentValue       = -9999;
+    _calcInputs         = NULL;
+    _calcInputCount     = 0;
+    _snapshotTaken      = false;
+    _snapshotInProgress = false;
 
     // MS_DBG(F("Calculated Variable object created"));
 }
@@ -84,7 +108,8 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode)
     : _sensorVarNum(0) {
-    _uuid = NULL;
+    _flashMetadata = NULL;
+    setVarUUID(NULL);
     setVarCode(varCode);
     setVarUnit(varUnit);
     setVarName(varName);
@@ -96,17 +121,22 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
 
     // When we create the variable, we also want to initialize it with a current
     // value of -9999 (ie, a bad result).
-    _currentValue = -9999;
+    _currentValue       = -9999;
+    _calcInputs         = NULL;
+    _calcInputCount     = 0;
+    _snapshotTaken      = false;
+    _snapshotInProgress = false;
 
     // MS_DBG(F("Calculated Variable object created"));
 }
 
 // constructor with no arguments
 Variable::Variable() : _sensorVarNum(0), _decimalResolution(0) {
-    _varName = NULL;
-    _varUnit = NULL;
-    _varCode = NULL;
-    _uuid    = NULL;
+    _varName       = NULL;
+    _varUnit       = NULL;
+    _varCode       = NULL;
+    _flashMetadata = NULL;
+    setVarUUID(NULL);
 
     isCalculated = true;
     _calcFxn     = NULL;
@@ -114,7 +144,11 @@ Variable::Variable() : _sensorVarNum(0), _decimalResolution(0) {
 
     // When we create the variable, we also want to initialize it with a current
     // value of -9999 (ie, a bad result).
-    _currentValue = -9999;
+    _currentValue       = -9999;
+    _calcInputs         = NULL;
+    _calcInputCount     = 0;
+    _snapshotTaken      = false;
+    _snapshotInProgress = false;
 
     // MS_DBG(F("Calculated Variable object created"));
 }
@@ -184,7 +218,8 @@ void Variable::attachSensor(Sensor* parentSense) {
 // This function should never be called for a calculated variable
 void Variable::onSensorUpdate(Sensor* parentSense) {
     if (!isCalculated) {
-        _currentValue = parentSense->sensorValues[_sensorVarNum];
+        _currentValue  = parentSense->sensorValues[_sensorVarNum];
+        _snapshotTaken = false;
         MS_DBG(F("... received"), _currentValue);
     }
 }
@@ -232,6 +267,13 @@ void Variable::setCalculation(float (*calcFxn)()) {
 }
 
 
+// This sets the variables a calculated variable needs calculated before it
+void Variable::setCalculationInputs(Variable* inputs[], uint8_t inputCount) {
+    _calcInputs     = inputs;
+    _calcInputCount = inputCount;
+}
+
+
 // This sets up the variable (generally attaching it to its parent)
 // bool Variable::setup(void)
 // {
@@ -246,14 +288,38 @@ uint8_t Variable::getResolution(void) {
 }
 void Variable::setResolution(uint8_t decimalResolution) {
     _decimalResolution = decimalResolution;
+    _snapshotTaken     = false;
     // MS_DBG(F("Variable resolution is"), _decimalResolution, F("decimal
     // places"));
 }
 
+// A filled-in field of the flash metadata table, or NULL if the text in RAM
+// should be used
+#define FLASH_METADATA(field)                                \
+    (_flashMetadata != NULL &&                               \
+             pgm_read_byte(_flashMetadata->field) != '\0'    \
+         ? _flashMetadata->field                             \
+         : NULL)
+#define AS_FLASH_STRING(text) \
+    reinterpret_cast<const __FlashStringHelper*>(text)
+
+// Makes a String of the flash text if there is any, otherwise of the RAM text
+static String metadataString(const char* ramText, const char* flashText) {
+    if (flashText != NULL) return String(AS_FLASH_STRING(flashText));
+    return ramText;
+}
+// Prints the flash text if there is any, otherwise the RAM text
+static size_t printMetadata(Print* stream, const char* ramText,
+                            const char* flashText) {
+    if (flashText != NULL) return stream->print(AS_FLASH_STRING(flashText));
+    if (ramText == NULL) return 0;
+    return stream->print(ramText);
+}
+
 // This gets/sets the variable's name using
 // http://vocabulary.odm2.org/variablename/
 String Variable::getVarName(void) {
-    return _varName;
+    return metadataString(_varName, FLASH_METADATA(varName));
 }
 void Variable::setVarName(const char* varName) {
     _varName = varName;
@@ -262,7 +328,7 @@ void Variable::setVarName(const char* varName) {
 
 // This gets/sets the variable's unit using http://vocabulary.odm2.org/units/
 String Variable::getVarUnit(void) {
-    return _varUnit;
+    return metadataString(_varUnit, FLASH_METADATA(varUnit));
 }
 void Variable::setVarUnit(const char* varUnit) {
     _varUnit = varUnit;
@@ -271,7 +337,7 @@ void Variable::setVarUnit(const char* varUnit) {
 
 // This returns a customized code for the variable
 String Variable::getVarCode(void) {
-    return _varCode;
+    return metadataString(_varCode, FLASH_METADATA(varCode));
 }
 // This sets the variable code to a new custom value
 void Variable::setVarCode(const char* varCode) {
@@ -281,60 +347,157 @@ void Variable::setVarCode(const char* varCode) {
 
 // This returns the variable UUID, if one has been assigned
 String Variable::getVarUUID(void) {
-    return _uuid;
+    return metadataString(_uuid, FLASH_METADATA(uuid));
 }
-// This sets the UUID
+// This sets the UUID and reads it into its bytes
 void Variable::setVarUUID(const char* uuid) {
     _uuid = uuid;
-    // if (strlen(_uuid) == 0)
-    // {
-    //     MS_DBG(F("No UUID assigned"));
-    // }
-    // else
-    // {
-    //     MS_DBG(F("Variable UUID is"), _uuid);
-    // }
+    parseUUID();
 }
 // This checks that the UUID is properly formatted
 bool Variable::checkUUIDFormat(void) {
-    // If no UUID, move on
-    if (strlen(_uuid) == 0) {
-        // MS_DBG(F("No UUID assigned to"), getVarCode());
-        return true;
+    switch (_uuidStatus) {
+        case UUID_BAD_LENGTH:
+            MS_DBG(F("UUID length for"), getVarCode(), '(', getVarUUID(), ')',
+                   F("is incorrect, should be 36 characters not"),
+                   getVarUUID().length());
+            return false;
+        case UUID_BAD_DASHES:
+            MS_DBG(F("UUID format for"), getVarCode(), '(', getVarUUID(), ')',
+                   F("is incorrect, expecting dashes at positions 9, 14, 19, "
+                     "and 24."));
+            return false;
+        case UUID_BAD_CHARACTER:
+            MS_DBG(F("UUID for"), getVarCode(), '(', getVarUUID(), ')',
+                   F("has a bad character"));
+            return false;
+        default:
+            // If no UUID, move on
+            return true;
     }
+}
+const uint8_t* Variable::getVarUUIDBytes(void) {
+    return _uuidStatus == UUID_OK ? _uuidBytes : NULL;
+}
+uint16_t Variable::getVarUUIDHash(void) {
+    return _uuidHash;
+}
+// This writes the UUID from its bytes, or copies it if it couldn't be read
+uint8_t Variable::getVarUUIDText(char* buffer, size_t bufferSize) {
+    if (bufferSize > 0) buffer[0] = '\0';
+    if (_uuidStatus == UUID_NOT_SET) return 0;
+    if (_uuidStatus != UUID_OK) {
+        const char* flashUUID = FLASH_METADATA(uuid);
+        size_t      length    = flashUUID != NULL ? strlen_P(flashUUID)
+                                                : strlen(_uuid);
+        if (length >= bufferSize || length > 255) return 0;
+        if (flashUUID != NULL) {
+            memcpy_P(buffer, flashUUID, length + 1);
+        } else {
+            memcpy(buffer, _uuid, length + 1);
+        }
+        return length;
+    }
+    if (bufferSize < 37) return 0;
+    const char* hexDigits = "0123456789abcdef";
+    uint8_t     length    = 0;
+    for (uint8_t i = 0; i < 16; i++) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) buffer[length++] = '-';
+        buffer[length++] = hexDigits[_uuidBytes[i] >> 4];
+        buffer[length++] = hexDigits[_uuidBytes[i] & 0x0F];
+    }
+    buffer[length] = '\0';
+    return length;
+}
 
-    // MS_DBG(F("Variable UUID for"), getVarCode(), F("is"), _uuid);
-    // Should be 36 characters long with dashes
-    if (strlen(_uuid) != 36) {
-        MS_DBG(F("UUID length for"), getVarCode(), '(', _uuid, ')',
-               F("is incorrect, should be 36 characters not"), strlen(_uuid));
-        return false;
+
+// This points the name, unit, code, and UUID at a table in flash
+void Variable::setMetadata(const variableMetadata* flashMetadata) {
+    _flashMetadata = flashMetadata;
+    parseUUID();
+}
+// These print the metadata straight from wherever it is kept
+size_t Variable::printVarName(Print* stream) {
+    return printMetadata(stream, _varName, FLASH_METADATA(varName));
+}
+size_t Variable::printVarUnit(Print* stream) {
+    return printMetadata(stream, _varUnit, FLASH_METADATA(varUnit));
+}
+size_t Variable::printVarCode(Print* stream) {
+    return printMetadata(stream, _varCode, FLASH_METADATA(varCode));
+}
+size_t Variable::printVarUUID(Print* stream) {
+    char uuidText[37];
+    if (getVarUUIDText(uuidText, sizeof(uuidText)) == 0) {
+        return printMetadata(stream, _uuid, FLASH_METADATA(uuid));
     }
+    return stream->print(uuidText);
+}
+
 
-    // "12345678-abcd-1234-ef00-1234567890ab"
-    const char* acceptableChars = "0123456789abcdefABCDEF-";
-    if (_uuid[8] != '-' || _uuid[13] != '-' || _uuid[18] != '-' ||
-        _uuid[23] != '-') {
-        MS_DBG(F("UUID format for"), getVarCode(), '(', _uuid, ')',
-               F("is incorrect, expecting dashes at positions 9, 14, 19, and "
-                 "24."));
-        return false;
+// The value of each character from '0' to 'f' as a hex digit; 0xFF for any
+// character that isn't one
+static const uint8_t hexDigitValues['f' - '0' + 1] PROGMEM = {
+    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 10,   11,   12,   13,   14,
+    15,   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 10,   11,   12,   13,   14,   15};
+
+// This reads a UUID like "12345678-abcd-1234-ef00-1234567890ab" into its 16
+// bytes and keeps a hash of them
+void Variable::parseUUID(void) {
+    _uuidHash = 0;
+    // A UUID kept in flash is copied out to be read; its field has room for
+    // no more than the 36 characters of a UUID
+    char        flashCopy[37];
+    const char* uuid      = _uuid;
+    const char* flashUUID = FLASH_METADATA(uuid);
+    if (flashUUID != NULL) {
+        memcpy_P(flashCopy, flashUUID, sizeof(flashCopy));
+        flashCopy[36] = '\0';
+        uuid          = flashCopy;
     }
-    for (uint8_t i = 0; i < 36; i++) {
-        bool isAcceptable = false;
-        for (uint8_t j = 0; !isAcceptable && j < 23; j++) {
-            if (_uuid[i] == acceptableChars[j]) {
-                isAcceptable = true;
-                j            = 23;  // Stop the inner loop
-            }
+    if (uuid == NULL || uuid[0] == '\0') {
+        _uuidStatus = UUID_NOT_SET;
+        return;
+    }
+    if (strlen(uuid) != 36) {
+        _uuidStatus = UUID_BAD_LENGTH;
+        return;
+    }
+    if (uuid[8] != '-' || uuid[13] != '-' || uuid[18] != '-' ||
+        uuid[23] != '-') {
+        _uuidStatus = UUID_BAD_DASHES;
+        return;
+    }
+    uint8_t byteNumber = 0;
+    for (uint8_t i = 0; i < 36; i += 2) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) i++;
+        uint8_t high = 0xFF;
+        uint8_t low  = 0xFF;
+        if (uuid[i] >= '0' && uuid[i] <= 'f') {
+            high = pgm_read_byte(&hexDigitValues[uuid[i] - '0']);
         }
-        if (!isAcceptable) {
-            MS_DBG(F("UUID for"), getVarCode(), '(', _uuid, ')',
-                   F("has a bad character"), _uuid[i], F("at"), i + 1);
-            return false;
+        if (uuid[i + 1] >= '0' && uuid[i + 1] <= 'f') {
+            low = pgm_read_byte(&hexDigitValues[uuid[i + 1] - '0']);
         }
+        if (high == 0xFF || low == 0xFF) {
+            _uuidStatus = UUID_BAD_CHARACTER;
+            return;
+        }
+        _uuidBytes[byteNumber++] = (high << 4) | low;
+    }
+
+    // A 32-bit FNV-1a hash, folded to 16 bits; never 0 for a real UUID
+    uint32_t hash = 2166136261UL;
+    for (uint8_t i = 0; i < 16; i++) {
+        hash ^= _uuidBytes[i];
+        hash *= 16777619UL;
     }
-    return true;
+    _uuidHash = static_cast<uint16_t>(hash ^ (hash >> 16));
+    if (_uuidHash == 0) _uuidHash = 1;
+    _uuidStatus = UUID_OK;
 }
 
 
@@ -345,6 +508,7 @@ float Variable::getValue(bool updateValue) {
         // the calculation because we don't know which sensors those are.
         // Make sure you update the parent sensors manually for a calculated
         // variable!!
+        if (_snapshotTaken) return _currentValue;
         return _calcFxn();
     } else {
         if (updateValue) parentSensor->update();
@@ -353,14 +517,84 @@ float Variable::getValue(bool updateValue) {
 }
 
 
+// This moves an update of the parent sensor on without waiting for it
+bool Variable::pollValue(void) {
+    if (isCalculated || parentSensor == NULL) return true;
+    if (!parentSensor->isUpdating()) parentSensor->beginUpdate();
+    return parentSensor->pollUpdate() != SENSOR_UPDATE_IN_PROGRESS;
+}
+
+
 // This returns the current value of the variable as a string
 // with the correct number of significant figures
 String Variable::getValueString(bool updateValue) {
-    // Need this because otherwise get extra spaces in strings from int
-    if (_decimalResolution == 0) {
-        int16_t val = static_cast<int16_t>(getValue(updateValue));
-        return String(val);
-    } else {
-        return String(getValue(updateValue), _decimalResolution);
+    char valueText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
+    getValueText(valueText, sizeof(valueText), updateValue);
+    return String(valueText);
+}
+// This writes the current value of the variable into a buffer, copying the
+// text from the snapshot when there is one
+uint8_t Variable::getValueText(char* buffer, size_t bufferSize,
+                               bool updateValue) {
+    if (!isCalculated) {
+        if (updateValue) parentSensor->update();
+        // A measured value only changes when the parent sensor notifies it
+        if (!_snapshotTaken) takeSnapshot();
     }
+    if (_snapshotTaken && _snapshotString[0] != '\0') {
+        uint8_t length = strlen(_snapshotString);
+        if (length >= bufferSize) {
+            if (bufferSize > 0) buffer[0] = '\0';
+            return 0;
+        }
+        memcpy(buffer, _snapshotString, length + 1);
+        return length;
+    }
+    return ValueFormatter::formatFloat(buffer, bufferSize, getValue(),
+                                       _decimalResolution);
+}
+
+
+// This keeps the value and its string until the next snapshot or update.
+// Calculated inputs are taken first, depth first, so the variables are
+// calculated in the order of their dependencies.
+void Variable::takeSnapshot(void) {
+    if (_snapshotInProgress) {
+        MS_DBG(F("The inputs of"), getVarCode(),
+               F("depend on it!  Using its value without them."));
+        return;
+    }
+    _snapshotInProgress = true;
+    _snapshotTaken      = false;
+    for (uint8_t i = 0; i < _calcInputCount; i++) {
+        Variable* input = _calcInputs[i];
+        if (input->isCalculated && !input->_snapshotTaken) {
+            input->takeSnapshot();
+        }
+    }
+    if (isCalculated) _currentValue = _calcFxn();
+    // A value string too long for the snapshot is left empty
+    ValueFormatter::formatFloat(_snapshotString, sizeof(_snapshotString),
+                                _currentValue, _decimalResolution);
+    _snapshotTaken      = true;
+    _snapshotInProgress = false;
+}
+void Variable::clearSnapshot(void) {
+    if (_snapshotInProgress) return;
+    _snapshotInProgress = true;
+    _snapshotTaken      = false;
+    for (uint8_t i = 0; i < _calcInputCount; i++) {
+        if (_calcInputs[i]->isCalculated) _calcInputs[i]->clearSnapshot();
+    }
+    _snapshotInProgress = false;
+}
+bool Variable::hasSnapshot(void) {
+    return _snapshotTaken;
+}
+
+
+// This checks if the current value was carried forward from an older update
+bool Variable::isValueStale(void) {
+    if (isCalculated || parentSensor == NULL) return false;
+    return parentSensor->areValuesStale();
 }
@@ -26,6 +26,68 @@ class Sensor;
 // Included Dependencies
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
+#include "ValueFormatter.h"
+
+/**
+ * @brief The longest value string kept in a variable's value snapshot.
+ *
+ * Each variable uses this many bytes of RAM plus one for the text of its
+ * snapshot.  Longer value strings aren't kept and are made again each time
+ * they are asked for.
+ */
+#ifndef MAX_VALUE_STRING_LENGTH
+#define MAX_VALUE_STRING_LENGTH 15
+#endif
+
+/**
+ * @brief The longest variable name kept in a #variableMetadata table.
+ */
+#ifndef MS_METADATA_NAME_LENGTH
+#define MS_METADATA_NAME_LENGTH 40
+#endif
+
+/**
+ * @brief The longest variable unit kept in a #variableMetadata table.
+ */
+#ifndef MS_METADATA_UNIT_LENGTH
+#define MS_METADATA_UNIT_LENGTH 32
+#endif
+
+/**
+ * @brief The longest variable code kept in a #variableMetadata table.
+ */
+#ifndef MS_METADATA_CODE_LENGTH
+#define MS_METADATA_CODE_LENGTH 24
+#endif
+
+/**
+ * @brief The name, unit, code, and UUID of a variable, laid out to be kept in
+ * flash rather than in RAM.
+ *
+ * On AVR boards every string given to a variable as a plain `const char*` is
+ * copied into RAM at startup.  A table declared `PROGMEM` stays in flash and
+ * is read from there each time it is printed:
+ *
+ * @code{cpp}
+ * const variableMetadata ctdCondMetadata PROGMEM = {
+ *     "", "", "CTDcond", "12345678-abcd-1234-ef00-1234567890ab"};
+ * Variable* ctdCond = new DecagonCTD_Cond(&ctd);
+ * ...
+ * ctdCond->setMetadata(&ctdCondMetadata);
+ * @endcode
+ *
+ * An empty field keeps the text given to the constructor or to begin().
+ */
+typedef struct variableMetadata {
+    /// The name of the variable per the ODM2 variable name vocabulary
+    char varName[MS_METADATA_NAME_LENGTH + 1];
+    /// The unit of the variable per the ODM2 unit vocabulary
+    char varUnit[MS_METADATA_UNIT_LENGTH + 1];
+    /// A custom code for the variable
+    char varCode[MS_METADATA_CODE_LENGTH + 1];
+    /// A universally unique identifier for the variable
+    char uuid[37];
+} variableMetadata;
 
 /**
  * @brief The variable class for a value and related metadata.
@@ -256,6 +318,21 @@ class Variable {
      * @param calcFxn Any function returning a float value.
      */
     void setCalculation(float (*calcFxn)());
+    /**
+     * @brief Declare the variables the calculation function of a calculated
+     * variable gets values from.
+     *
+     * When a variable array takes its snapshots, the calculated inputs are
+     * calculated first, so each calculated variable is only calculated once
+     * per update no matter how many others use it; see takeSnapshot().  The
+     * calculation function should get the values of its inputs with
+     * getValue() rather than by calling their calculation functions.
+     *
+     * @param inputs An array of the input variables; it is not copied, so it
+     * must outlive the variable.
+     * @param inputCount The number of variables in the array.
+     */
+    void setCalculationInputs(Variable* inputs[], uint8_t inputCount);
 
     // This gets/sets the variable's resolution for value strings
     /**
@@ -325,6 +402,8 @@ class Variable {
     /**
      * @brief Set a customized code for the variable
      *
+     * The UUID is read into its 16 bytes right away; see getVarUUIDBytes().
+     *
      * @param uuid A universally unique identifier for the variable.
      */
     void setVarUUID(const char* uuid);
@@ -337,6 +416,74 @@ class Variable {
      * indicate that the value of the UUID is correct.
      */
     bool checkUUIDFormat(void);
+    /**
+     * @brief Get the 16 bytes of the UUID.
+     *
+     * @return **const uint8_t\*** The bytes, or NULL if there is no UUID or
+     * it isn't correctly formatted.
+     */
+    const uint8_t* getVarUUIDBytes(void);
+    /**
+     * @brief Get a short hash of the bytes of the UUID, for a quick check
+     * that two UUIDs differ.
+     *
+     * @return **uint16_t** The hash; 0 if there is no correctly formatted
+     * UUID.
+     */
+    uint16_t getVarUUIDHash(void);
+    /**
+     * @brief Write the UUID into a character buffer.
+     *
+     * A correctly formatted UUID is written from its bytes, in lower case.
+     * Anything else is copied as it was given.
+     *
+     * @param buffer The buffer to write into; 37 characters are enough for
+     * any correctly formatted UUID.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator; 0 if there is no UUID or it doesn't fit in the buffer.
+     */
+    uint8_t getVarUUIDText(char* buffer, size_t bufferSize);
+    /**
+     * @brief Use a table kept in flash for the name, unit, code, and UUID of
+     * the variable.
+     *
+     * Each filled-in field of the table takes the place of the text given to
+     * the constructor, to begin(), or to the set functions; empty fields are
+     * ignored.
+     *
+     * @param flashMetadata A #variableMetadata table declared `PROGMEM`, or
+     * NULL to go back to the text in RAM.
+     */
+    void setMetadata(const variableMetadata* flashMetadata);
+    /**
+     * @brief Print the variable name without making a String copy of it.
+     *
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarName(Print* stream);
+    /**
+     * @brief Print the variable unit without making a String copy of it.
+     *
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarUnit(Print* stream);
+    /**
+     * @brief Print the variable code without making a String copy of it.
+     *
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarCode(Print* stream);
+    /**
+     * @brief Print the variable UUID as getVarUUIDText() writes it.
+     *
+     * @param stream The stream to print to.
+     * @return **size_t** The number of characters printed.
+     */
+    size_t printVarUUID(Print* stream);
 
     /**
      * @brief Get current value of the variable as a float
@@ -346,6 +493,19 @@ class Variable {
      * @return **float** The current value of the variable
      */
     float getValue(bool updateValue = false);
+    /**
+     * @brief Get a new value from the parent sensor without waiting on it.
+     *
+     * This is the non-blocking version of getValue(true).  Call it over and
+     * over until it returns true; each call starts an update of the parent
+     * sensor if one isn't already running and moves it on with
+     * Sensor::pollUpdate().  Once it returns true, getValue() gives the new
+     * value, or -9999 if the sensor couldn't be woken.  For a calculated
+     * variable this always returns true right away.
+     *
+     * @return **bool** True once the update of the parent sensor is finished.
+     */
+    bool pollValue(void);
     /**
      * @brief Get current value of the variable as a string with the correct
      * decimal resolution
@@ -355,6 +515,57 @@ class Variable {
      * @return **String** The current value of the variable
      */
     String getValueString(bool updateValue = false);
+    /**
+     * @brief Write the current value of the variable, with the correct
+     * decimal resolution, into a character buffer.
+     *
+     * This gives the same text as getValueString() without making a String.
+     *
+     * @param buffer The buffer to write into.
+     * @param bufferSize The size of the buffer, including the terminator.
+     * #MS_MAX_FORMATTED_FLOAT_LENGTH plus one is always enough.
+     * @param updateValue True to ask the parent sensor to measure and return a
+     * new value.  Default is false.
+     * @return **uint8_t** The number of characters written, not including the
+     * terminator; 0 if the value doesn't fit in the buffer.
+     */
+    uint8_t getValueText(char* buffer, size_t bufferSize,
+                         bool updateValue = false);
+    /**
+     * @brief Check whether the current value of the variable is stale.
+     *
+     * A value is stale when it was carried forward from an earlier update
+     * because the parent sensor was not due to be sampled in the latest one.
+     * Calculated variables are never flagged as stale.
+     *
+     * @return **bool** True if the current value is stale.
+     */
+    bool isValueStale(void);
+    /**
+     * @brief Keep the current value and its value string until the next
+     * update, so they're only calculated and formatted once for the CSV file
+     * and all of the publishers.
+     *
+     * This is called for every variable at the end of each update of a
+     * variable array.  The snapshot of a measured variable is dropped as soon
+     * as its parent sensor notifies it of a new value and is taken again when
+     * next asked for.  A calculated variable first takes the snapshots of any
+     * calculated inputs set with setCalculationInputs() that don't have one,
+     * then runs its calculation and keeps the result as its current value
+     * until clearSnapshot() is called.
+     */
+    void takeSnapshot(void);
+    /**
+     * @brief Drop the snapshot of this variable and of its calculated inputs,
+     * so a calculated variable is calculated again.
+     */
+    void clearSnapshot(void);
+    /**
+     * @brief Check whether the variable has a snapshot.
+     *
+     * @return **bool** True if the variable has a snapshot.
+     */
+    bool hasSnapshot(void);
 
     /**
      * @brief Pointer to the parent sensor
@@ -381,6 +592,20 @@ class Variable {
     const char* _varUnit;
     const char* _varCode;
     const char* _uuid;
+    uint8_t     _uuidBytes[16];
+    uint16_t    _uuidHash;
+    uint8_t     _uuidStatus;
+
+    const variableMetadata* _flashMetadata;
+
+    void parseUUID(void);
+
+    Variable** _calcInputs;
+    uint8_t    _calcInputCount;
+
+    bool _snapshotTaken;
+    bool _snapshotInProgress;
+    char _snapshotString[MAX_VALUE_STRING_LENGTH + 1];
 };
 
 #endif  // SRC_VARIABLEBASE_H_
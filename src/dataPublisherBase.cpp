@@ -110,6 +110,22 @@ void dataPublisher::printTxBuffer(Stream* stream, bool addNewLine) {
 }
 
 
+// Writes a value onto the end of the TX buffer, without a temporary copy
+uint8_t dataPublisher::txBufferAppendValue(uint8_t position_i) {
+    size_t length = strlen(txBuffer);
+    return _baseLogger->getValueTextAtI(position_i, txBuffer + length,
+                                        MS_SEND_BUFFER_SIZE - length);
+}
+
+
+// Writes a UUID onto the end of the TX buffer from its bytes
+uint8_t dataPublisher::txBufferAppendUUID(uint8_t position_i) {
+    size_t length = strlen(txBuffer);
+    return _baseLogger->getVarUUIDTextAtI(position_i, txBuffer + length,
+                                          MS_SEND_BUFFER_SIZE - length);
+}
+
+
 // This sends data on the "default" client of the modem
 int16_t dataPublisher::publishData() {
     if (_inClient == NULL) {
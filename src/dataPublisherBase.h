@@ -301,6 +301,27 @@ class dataPublisher {
      * the print
      */
     static void printTxBuffer(Stream* stream, bool addNewLine = false);
+    /**
+     * @brief Write the value of the variable at the given position in the
+     * logger's variable array straight onto the end of the TX buffer.
+     *
+     * Make sure there are at least #MS_MAX_FORMATTED_FLOAT_LENGTH plus one
+     * empty spots in the buffer first; a value that doesn't fit isn't written.
+     *
+     * @param position_i The position of the variable in the array.
+     * @return **uint8_t** The number of characters written.
+     */
+    uint8_t txBufferAppendValue(uint8_t position_i);
+    /**
+     * @brief Write the UUID of the variable at the given position in the
+     * logger's variable array straight onto the end of the TX buffer.
+     *
+     * Make sure there are at least 37 empty spots in the buffer first.
+     *
+     * @param position_i The position of the variable in the array.
+     * @return **uint8_t** The number of characters written.
+     */
+    uint8_t txBufferAppendUUID(uint8_t position_i);
 
     /**
      * @brief Unimplemented; intended for future use to enable caching and bulk
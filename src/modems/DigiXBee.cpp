@@ -34,7 +34,7 @@ bool DigiXBee::modemWakeFxn(void) {
         // Don't go to sleep if there's not a wake pin!
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                _wakeLevel ? F("HIGH") : F("LOW"), F("to wake"), _modemName);
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         return true;
     } else {
         return true;
@@ -47,7 +47,7 @@ bool DigiXBee::modemSleepFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                !_wakeLevel ? F("HIGH") : F("LOW"), F("to put"), _modemName,
                F("to sleep"));
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         return true;
     } else {
         return true;
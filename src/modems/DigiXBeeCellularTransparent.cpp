@@ -51,7 +51,7 @@ bool DigiXBeeCellularTransparent::modemWakeFxn(void) {
         // Don't go to sleep if there's not a wake pin!
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                _wakeLevel ? F("HIGH") : F("LOW"), F("to wake"), _modemName);
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         MS_DBG(F("Turning off airplane mode..."));
         if (gsmModem.commandMode()) {
             gsmModem.sendAT(GF("AM"), 0);
@@ -83,7 +83,7 @@ bool DigiXBeeCellularTransparent::modemSleepFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                !_wakeLevel ? F("HIGH") : F("LOW"), F("to put"), _modemName,
                F("to sleep"));
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         return true;
     } else {
         return true;
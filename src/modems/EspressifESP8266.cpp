@@ -84,10 +84,10 @@ bool EspressifESP8266::ESPwaitForBoot(void) {
 bool EspressifESP8266::modemWakeFxn(void) {
     bool success = true;
     if (_powerPin >= 0) {  // Turns on when power is applied
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         success &= ESPwaitForBoot();
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, _wakeLevel);
+            _modemSleepRqPinHandle.write(_wakeLevel);
         }
         return success;
     } else if (_modemResetPin >= 0) {
@@ -96,17 +96,17 @@ bool EspressifESP8266::modemWakeFxn(void) {
         digitalWrite(_modemResetPin, LOW);
         delay(_resetPulse_ms);
         digitalWrite(_modemResetPin, HIGH);
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         success &= ESPwaitForBoot();
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, _wakeLevel);
+            _modemSleepRqPinHandle.write(_wakeLevel);
         }
         return success;
     } else if (_modemSleepRqPin >= 0) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                _wakeLevel ? F("HIGH") : F("LOW"),
                F("to wake ESP8266 from light sleep"));
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         return success;
     } else {
         return true;
@@ -133,7 +133,7 @@ bool EspressifESP8266::modemSleepFxn(void) {
         MS_DBG(F("Requesting deep sleep for ESP8266"));
         bool retVal = gsmModem.poweroff();
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, !_wakeLevel);
+            _modemSleepRqPinHandle.write(!_wakeLevel);
         }
         return retVal;
     } else if (_modemSleepRqPin >= 0 && _statusPin >= 0) {
@@ -164,7 +164,7 @@ bool EspressifESP8266::modemSleepFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                _statusLevel ? F("HIGH") : F("LOW"),
                F("to allow ESP8266 to enter light sleep"));
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         MS_DBG(F("Requesting light sleep for ESP8266 with status indication"));
         gsmModem.sendAT(GF("+WAKEUPGPIO=1,"), String(_espSleepRqPin), F(",0,"),
                         String(_espStatusPin), ',', _statusLevel);
@@ -184,7 +184,7 @@ bool EspressifESP8266::modemSleepFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                !_wakeLevel ? F("HIGH") : F("LOW"),
                F("to allow ESP8266 to enter light sleep"));
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         MS_DBG(F("Module MIGHT enter light sleep mode if it has been idle for "
                  "sufficient time."));
         return success;
@@ -196,7 +196,7 @@ bool EspressifESP8266::modemSleepFxn(void) {
 
 // Set up the light-sleep status pin, if applicable
 bool EspressifESP8266::extraModemSetup(void) {
-    if (_modemSleepRqPin >= 0) { digitalWrite(_modemSleepRqPin, !_wakeLevel); }
+    if (_modemSleepRqPin >= 0) { _modemSleepRqPinHandle.write(!_wakeLevel); }
     gsmModem.init();
     gsmClient.init(&gsmModem);
     _modemName = gsmModem.getModemName();
@@ -49,7 +49,7 @@
             /** If there's a pulse wake up (ie, non-zero wake time) and        \
                there's a status pin, use that to determine if the modem was    \
                awake before setup began. */                                    \
-            bool levelNow = digitalRead(_statusPin);                           \
+            bool levelNow = _statusPinHandle.read();                           \
             MS_DBG(getModemName(), F("status pin"), _statusPin, F("level = "), \
                    levelNow ? F("HIGH") : F("LOW"), F("meaning"),              \
                    getModemName(), F("should be"),                             \
@@ -60,11 +60,7 @@
                we're going to check the level of the held pin as the           \
                indication of whether attempts were made to wake the modem      \
                before entering the setup function. */                          \
-            int8_t sleepRqBitNumber =                                          \
-                log(digitalPinToBitMask(_modemSleepRqPin)) / log(2);           \
-            bool currentRqPinState = bitRead(                                  \
-                *portInputRegister(digitalPinToPort(_modemSleepRqPin)),        \
-                sleepRqBitNumber);                                             \
+            bool currentRqPinState = _modemSleepRqPinHandle.read();            \
             MS_DBG(F("Current state of sleep request pin"), _modemSleepRqPin,  \
                    '=', currentRqPinState ? F("HIGH") : F("LOW"),              \
                    F("meaning"), getModemName(), F("should be"),               \
@@ -55,9 +55,9 @@ bool QuectelBG96::modemWakeFxn(void) {
         MS_DBG(F("Sending a"), _wakePulse_ms, F("ms"),
                _wakeLevel ? F("HIGH") : F("LOW"), F("wake-up pulse on pin"),
                _modemSleepRqPin, F("for"), _modemName);
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         delay(_wakePulse_ms);  // ≥100ms
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         return gsmModem.waitResponse(10000L, GF("RDY")) == 1;
     }
     return true;
@@ -75,7 +75,7 @@ bool QuectelBG96::modemSleepFxn(void) {
 }
 
 bool QuectelBG96::modemHardReset(void) {
-    digitalWrite(_modemSleepRqPin, !_wakeLevel);  // set the wake pin high
+    _modemSleepRqPinHandle.write(!_wakeLevel);  // set the wake pin high
     bool success = loggerModem::modemHardReset();
     if (success) { return gsmModem.waitResponse(10000L, GF("RDY")) == 1; }
     return false;
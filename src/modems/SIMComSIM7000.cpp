@@ -55,9 +55,9 @@ bool SIMComSIM7000::modemWakeFxn(void) {
         MS_DBG(F("Sending a"), _wakePulse_ms, F("ms"),
                _wakeLevel ? F("HIGH") : F("LOW"), F("wake-up pulse on pin"),
                _modemSleepRqPin, F("for"), _modemName);
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         delay(_wakePulse_ms);  // >1s
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
     }
     return true;
 }
@@ -55,7 +55,7 @@ bool SequansMonarch::modemWakeFxn(void) {
         // Drop the RTS if it's connected - this won't wake the board,
         // but the library will be confused if the pin is the wrong level
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, _wakeLevel);
+            _modemSleepRqPinHandle.write(_wakeLevel);
         }
         // Wait for system start
         MS_DBG(F("Waiting for modem start-up message"));
@@ -64,7 +64,7 @@ bool SequansMonarch::modemWakeFxn(void) {
         // Drop the RTS if it's connected - this won't wake the board,
         // but the library will be confused if the pin is the wrong level
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, _wakeLevel);
+            _modemSleepRqPinHandle.write(_wakeLevel);
         }
         // Hard reset is only way to wake from shut-down
         modemHardReset();
@@ -77,7 +77,7 @@ bool SequansMonarch::modemWakeFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                _wakeLevel ? F("HIGH") : F("LOW"), F("to bring"), _modemName,
                F("out of power save mode"));
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         return true;
     } else {
         return true;
@@ -97,7 +97,7 @@ bool SequansMonarch::modemSleepFxn(void) {
         // check this pin as an indication of whether the board is awake even if
         // it's not being used as the main wake source
         if (_modemSleepRqPin >= 0) {
-            digitalWrite(_modemSleepRqPin, !_wakeLevel);
+            _modemSleepRqPinHandle.write(!_wakeLevel);
         }
         return retVal;
     } else if (_modemSleepRqPin >= 0) {
@@ -105,7 +105,7 @@ bool SequansMonarch::modemSleepFxn(void) {
         MS_DBG(F("Setting pin"), _modemSleepRqPin,
                !_wakeLevel ? F("HIGH") : F("LOW"), F("to enable"), _modemName,
                F("to enter power save mode"));
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         return true;
     } else {  // DON'T go to sleep if we can't wake up!
         return true;
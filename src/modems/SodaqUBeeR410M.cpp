@@ -75,7 +75,7 @@ bool SodaqUBeeR410M::modemWakeFxn(void) {
         MS_DBG(F("Sending a"), _wakePulse_ms, F("ms"),
                _wakeLevel ? F("HIGH") : F("LOW"), F("wake-up pulse on pin"),
                _modemSleepRqPin, F("for Sodaq UBee R410M"));
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
 
         // If possible, monitor the v_int pin waiting for it to become high
         // before ending pulse
@@ -83,9 +83,9 @@ bool SodaqUBeeR410M::modemWakeFxn(void) {
             uint32_t startTimer = millis();
             // 0.15-3.2s pulse for wake on SARA R4/N4 (ie, max is 3.2s)
             // Wait no more than 3.2s
-            while (digitalRead(_statusPin) != static_cast<int>(_statusLevel) &&
+            while (_statusPinHandle.read() != _statusLevel &&
                    millis() - startTimer < 3200L) {}
-            if (digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {
+            if (_statusPinHandle.read() == _statusLevel) {
                 // Print when the pin lit up, if it lights up before end of 3.2s
                 MS_DBG(F("Status pin came on after"), millis() - startTimer,
                        F("ms"));
@@ -96,7 +96,7 @@ bool SodaqUBeeR410M::modemWakeFxn(void) {
             // Say how long we pulsed for
             MS_DBG(F("Pulsed for"), millis() - startTimer, F("ms"));
 
-            if (digitalRead(_statusPin) != static_cast<int>(_statusLevel)) {
+            if (_statusPinHandle.read() != _statusLevel) {
                 // make note if the pin never lit up!
                 MS_DBG(F("Status pin never turned on!"));
             }
@@ -104,7 +104,7 @@ bool SodaqUBeeR410M::modemWakeFxn(void) {
             delay(_wakePulse_ms);  // 0.15-3.2s pulse for wake on SARA R4/N4
         }
 
-        digitalWrite(_modemSleepRqPin, HIGH);
+        _modemSleepRqPinHandle.write(HIGH);
 // Need to slow down R4/N4's default 115200 baud rate for slow processors
 // The baud rate setting is NOT saved to non-volatile memory, so it must
 // be changed every time after loosing power.
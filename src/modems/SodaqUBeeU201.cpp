@@ -56,10 +56,10 @@ bool SodaqUBeeU201::modemWakeFxn(void) {
         MS_DBG(F("Sending a"), _wakePulse_ms, F("ms"),
                _wakeLevel ? F("HIGH") : F("LOW"), F("wake-up pulse on pin"),
                _modemSleepRqPin, F("for Sodaq UBee U201"));
-        digitalWrite(_modemSleepRqPin, _wakeLevel);
+        _modemSleepRqPinHandle.write(_wakeLevel);
         // 50-80µs pulse for wake on SARA/LISA U2/G2
         delayMicroseconds(_wakePulse_ms);
-        digitalWrite(_modemSleepRqPin, !_wakeLevel);
+        _modemSleepRqPinHandle.write(!_wakeLevel);
         return true;
     } else {
         return true;
@@ -71,9 +71,11 @@ void DreamHostPublisher::printSensorDataDreamHost(Stream* stream) {
 
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         stream->print('&');
-        stream->print(_baseLogger->getVarCodeAtI(i));
+        _baseLogger->printVarCodeAtI(i, stream);
         stream->print('=');
-        stream->print(_baseLogger->getValueStringAtI(i));
+        char valueText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
+        _baseLogger->getValueTextAtI(i, valueText, sizeof(valueText));
+        stream->print(valueText);
     }
 }
 
@@ -144,8 +146,10 @@ int16_t DreamHostPublisher::publishData(Client* outClient) {
             _baseLogger->getVarCodeAtI(i).toCharArray(tempBuffer, 37);
             strcat(txBuffer, tempBuffer);
             txBuffer[strlen(txBuffer)] = '=';
-            _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 37);
-            strcat(txBuffer, tempBuffer);
+            if (bufferFree() < MS_MAX_FORMATTED_FLOAT_LENGTH + 1) {
+                printTxBuffer(outClient);
+            }
+            txBufferAppendValue(i);
         }
 
         // add the rest of the HTTP GET headers to the outgoing buffer
@@ -83,11 +83,13 @@ uint16_t EnviroDIYPublisher::calculateJsonSize() {
     jsonLength += 15;          // ","timestamp":"
     jsonLength += 25;          // markedISO8601Time
     jsonLength += 2;           //  ",
+    char     valueText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         jsonLength += 1;   //  "
         jsonLength += 36;  // variable UUID
         jsonLength += 2;   //  ":
-        jsonLength += _baseLogger->getValueStringAtI(i).length();
+        jsonLength += _baseLogger->getValueTextAtI(i, valueText,
+                                                   sizeof(valueText));
         if (i + 1 != _baseLogger->getArrayVarCount()) {
             jsonLength += 1;  // ,
         }
@@ -122,14 +124,21 @@ void EnviroDIYPublisher::printSensorDataJSON(Stream* stream) {
     stream->print(samplingFeatureTag);
     stream->print(_baseLogger->getSamplingFeatureUUID());
     stream->print(timestampTag);
-    stream->print(_baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime));
+    // The time stamp, the UUIDs, and the values are all written into the same
+    // buffer, which is long enough for a UUID
+    char text[37];
+    _baseLogger->formatDateTime_ISO8601(text, sizeof(text),
+                                        Logger::markedEpochTime);
+    stream->print(text);
     stream->print(F("\","));
 
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         stream->print('"');
-        stream->print(_baseLogger->getVarUUIDAtI(i));
+        _baseLogger->getVarUUIDTextAtI(i, text, sizeof(text));
+        stream->print(text);
         stream->print(F("\":"));
-        stream->print(_baseLogger->getValueStringAtI(i));
+        _baseLogger->getValueTextAtI(i, text, sizeof(text));
+        stream->print(text);
         if (i + 1 != _baseLogger->getArrayVarCount()) { stream->print(','); }
     }
 
@@ -233,9 +242,9 @@ int16_t EnviroDIYPublisher::publishData(Client* outClient) {
 
         if (bufferFree() < 42) printTxBuffer(outClient);
         strcat(txBuffer, timestampTag);
-        _baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime)
-            .toCharArray(tempBuffer, 37);
-        strcat(txBuffer, tempBuffer);
+        _baseLogger->formatDateTime_ISO8601(txBuffer + strlen(txBuffer),
+                                            bufferFree(),
+                                            Logger::markedEpochTime);
         txBuffer[strlen(txBuffer)] = '"';
         txBuffer[strlen(txBuffer)] = ',';
 
@@ -244,12 +253,13 @@ int16_t EnviroDIYPublisher::publishData(Client* outClient) {
             if (bufferFree() < 47) printTxBuffer(outClient);
 
             txBuffer[strlen(txBuffer)] = '"';
-            _baseLogger->getVarUUIDAtI(i).toCharArray(tempBuffer, 37);
-            strcat(txBuffer, tempBuffer);
+            txBufferAppendUUID(i);
             txBuffer[strlen(txBuffer)] = '"';
             txBuffer[strlen(txBuffer)] = ':';
-            _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 37);
-            strcat(txBuffer, tempBuffer);
+            if (bufferFree() < MS_MAX_FORMATTED_FLOAT_LENGTH + 1) {
+                printTxBuffer(outClient);
+            }
+            txBufferAppendValue(i);
             if (i + 1 != _baseLogger->getArrayVarCount()) {
                 txBuffer[strlen(txBuffer)] = ',';
             } else {
@@ -146,10 +146,9 @@ int16_t ThingSpeakPublisher::publishData(Client* outClient) {
 
     emptyTxBuffer();
 
-    _baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime)
-        .toCharArray(tempBuffer, 26);
     strcat(txBuffer, "created_at=");
-    strcat(txBuffer, tempBuffer);
+    _baseLogger->formatDateTime_ISO8601(txBuffer + strlen(txBuffer),
+                                        bufferFree(), Logger::markedEpochTime);
     txBuffer[strlen(txBuffer)] = '&';
 
     for (uint8_t i = 0; i < numChannels; i++) {
@@ -157,8 +156,7 @@ int16_t ThingSpeakPublisher::publishData(Client* outClient) {
         itoa(i + 1, tempBuffer, 10);  // BASE 10
         strcat(txBuffer, tempBuffer);
         txBuffer[strlen(txBuffer)] = '=';
-        _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 26);
-        strcat(txBuffer, tempBuffer);
+        txBufferAppendValue(i);
         if (i + 1 != numChannels) { txBuffer[strlen(txBuffer)] = '&'; }
     }
     MS_DBG(F("Message ["), strlen(txBuffer), F("]:"), String(txBuffer));
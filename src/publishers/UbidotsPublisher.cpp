@@ -83,12 +83,15 @@ uint16_t UbidotsPublisher::calculateJsonSize() {
     // jsonLength += 15;          // ","timestamp":"
     // jsonLength += 25;          // markedISO8601Time
     // jsonLength += 2;           //  ",
+    char uuidText[37];
+    char valueText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         jsonLength += 1;  //  "
-        jsonLength +=
-            _baseLogger->getVarUUIDAtI(i).length();  // parameter ID length
-        jsonLength += 11;                            //  ":{"value":
-        jsonLength += _baseLogger->getValueStringAtI(i).length();
+        jsonLength += _baseLogger->getVarUUIDTextAtI(
+            i, uuidText, sizeof(uuidText));  // parameter ID length
+        jsonLength += 11;                    //  ":{"value":
+        jsonLength += _baseLogger->getValueTextAtI(i, valueText,
+                                                   sizeof(valueText));
         jsonLength += 13;  // ,"timestamp":
         jsonLength += 13;  // epoch time in milliseconds
         if (i + 1 != _baseLogger->getArrayVarCount()) {
@@ -107,9 +110,13 @@ void UbidotsPublisher::printSensorDataJSON(Stream* stream) {
 
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         stream->print('"');
-        stream->print(_baseLogger->getVarUUIDAtI(i));
+        char uuidText[37];
+        _baseLogger->getVarUUIDTextAtI(i, uuidText, sizeof(uuidText));
+        stream->print(uuidText);
         stream->print(F("\":{'value':"));
-        stream->print(_baseLogger->getValueStringAtI(i));
+        char valueText[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
+        _baseLogger->getValueTextAtI(i, valueText, sizeof(valueText));
+        stream->print(valueText);
         stream->print(",'timestamp':");
         stream->print(Logger::markedEpochTimeUTC);
         stream->print(
@@ -214,16 +221,17 @@ int16_t UbidotsPublisher::publishData(Client* outClient) {
             if (bufferFree() < 47) printTxBuffer(outClient);
 
             txBuffer[strlen(txBuffer)] = '"';
-            _baseLogger->getVarUUIDAtI(i).toCharArray(tempBuffer, 37);
-            strcat(txBuffer, tempBuffer);
+            txBufferAppendUUID(i);
             txBuffer[strlen(txBuffer)] = '"';
             strcat(txBuffer, ":{");
             txBuffer[strlen(txBuffer)] = '"';
             strcat(txBuffer, "value");
             txBuffer[strlen(txBuffer)] = '"';
             txBuffer[strlen(txBuffer)] = ':';
-            _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 37);
-            strcat(txBuffer, tempBuffer);
+            if (bufferFree() < MS_MAX_FORMATTED_FLOAT_LENGTH + 1) {
+                printTxBuffer(outClient);
+            }
+            txBufferAppendValue(i);
             txBuffer[strlen(txBuffer)] = ',';
             txBuffer[strlen(txBuffer)] = '"';
             strcat(txBuffer, "timestamp");
@@ -18,12 +18,14 @@ AOSongAM2315::AOSongAM2315(TwoWire* theI2C, int8_t powerPin,
              AM2315_STABILIZATION_TIME_MS, AM2315_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
     _i2c = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 AOSongAM2315::AOSongAM2315(int8_t powerPin, uint8_t measurementsToAverage)
     : Sensor("AOSongAM2315", AM2315_NUM_VARIABLES, AM2315_WARM_UP_TIME_MS,
              AM2315_STABILIZATION_TIME_MS, AM2315_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
     _i2c = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 AOSongAM2315::~AOSongAM2315() {}
 
@@ -41,9 +41,9 @@ float AnalogElecConductivity::readEC() {
 
 
 float AnalogElecConductivity::readEC(uint8_t analogPinNum) {
-    uint32_t sensorEC_adc;
-    float    Rwater_ohms;      // literal value of water
-    float    EC_uScm = -9999;  // units are uS per cm
+    float sensorEC_adc;
+    float Rwater_ohms;      // literal value of water
+    float EC_uScm = -9999;  // units are uS per cm
 
     // Set the resolution for the processor ADC, only applies to SAMD boards.
 #if !defined ARDUINO_ARCH_AVR
@@ -59,11 +59,20 @@ float AnalogElecConductivity::readEC(uint8_t analogPinNum) {
     // Take a priming reading.
     // First reading will be low - discard
     analogRead(analogPinNum);
-    // Take the reading we'll keep
-    sensorEC_adc = analogRead(analogPinNum);
+    if (_burstSampler != NULL) {
+        // Take a burst of readings and keep its reduced value
+        _burstSampler->begin();
+        do {
+            _burstSampler->addSample(analogRead(analogPinNum));
+        } while (_burstSampler->waitForNextSample());
+        sensorEC_adc = _burstSampler->reduce();
+    } else {
+        // Take the reading we'll keep
+        sensorEC_adc = analogRead(analogPinNum);
+    }
     MS_DEEP_DBG("adc bits=", sensorEC_adc);
 
-    if (0 == sensorEC_adc) {
+    if (sensorEC_adc < 1) {
         // Prevent underflow, can never be ANALOG_EC_ADC_RANGE
         sensorEC_adc = 1;
     }
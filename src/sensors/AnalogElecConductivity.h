@@ -369,6 +369,9 @@ class AnalogElecConductivity : public Sensor {
     /**
      * @brief reads the calculated EC from an analog pin.
      *
+     * If a BurstSampler is set, the EC is calculated from the reduced value of
+     * a burst of readings instead of from a single reading.
+     *
      * @param analogPinNum Analog port pin number
      * @return The electrical conductance value
      */
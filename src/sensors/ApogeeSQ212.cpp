@@ -15,6 +15,14 @@
 #include <Adafruit_ADS1015.h>
 
 
+// The PAR and the voltage are both proportional to the ADC counts, so they're
+// only calculated once, from the average count
+static const rawResultCalibration sq212Calibration[] = {
+    {SQ212_PAR_VAR_NUM,
+     1000 * SQ212_VOLTS_PER_COUNT * SQ212_CALIBRATION_FACTOR, 0},
+    {SQ212_VOLTAGE_VAR_NUM, SQ212_VOLTS_PER_COUNT, 0}};
+
+
 // The constructor - need the power pin and the data pin
 ApogeeSQ212::ApogeeSQ212(int8_t powerPin, uint8_t adsChannel,
                          uint8_t i2cAddress, uint8_t measurementsToAverage)
@@ -23,6 +31,7 @@ ApogeeSQ212::ApogeeSQ212(int8_t powerPin, uint8_t adsChannel,
              -1, measurementsToAverage) {
     _adsChannel = adsChannel;
     _i2cAddress = i2cAddress;
+    setRawCalibration(sq212Calibration, 2);
 }
 // Destructor
 ApogeeSQ212::~ApogeeSQ212() {}
@@ -42,9 +51,10 @@ String ApogeeSQ212::getSensorLocation(void) {
 
 
 bool ApogeeSQ212::addSingleMeasurementResult(void) {
-    // Variables to store the results in
-    float adcVoltage  = -9999;
-    float calibResult = -9999;
+    // The limits of a good reading, 3.6V and -0.3V, in ADC counts
+    const int16_t maxCount = 3.6 / SQ212_VOLTS_PER_COUNT;
+    const int16_t minCount = -0.3 / SQ212_VOLTS_PER_COUNT;
+    bool          success  = false;
 
     // Check a measurement was *successfully* started (status bit 6 set)
     // Only go on to get a result if it was
@@ -78,37 +88,26 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
 
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
-        // We're allowing the ADS1115 library to do the bit-to-volts conversion
-        // for us
-        adcVoltage =
-            ads.readADC_SingleEnded_V(_adsChannel);  // Getting the reading
-        MS_DBG(F("  ads.readADC_SingleEnded_V("), _adsChannel, F("):"),
-               adcVoltage);
-
-        if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-            // Skip results out of range
-            // Apogee SQ-212 Calibration Factor = 1.0 μmol m-2 s-1 per mV;
-            calibResult = 1000 * adcVoltage * SQ212_CALIBRATION_FACTOR;
-            MS_DBG(F("  calibResult:"), calibResult);
-        } else {
-            // set invalid voltages back to -9999
-            adcVoltage = -9999;
+        // The reading is kept in counts; the bit-to-volts conversion and the
+        // Apogee SQ-212 Calibration Factor = 1.0 μmol m-2 s-1 per mV are
+        // applied to the average
+        int16_t adcCounts = ads.readADC_SingleEnded(_adsChannel);
+        MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("):"),
+               adcCounts);
+
+        // Skip results out of range
+        if (adcCounts < maxCount && adcCounts > minCount) {
+            addRawMeasurementResult(adcCounts);
+            success = true;
         }
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
-    verifyAndAddMeasurementResult(SQ212_PAR_VAR_NUM, calibResult);
-    verifyAndAddMeasurementResult(SQ212_VOLTAGE_VAR_NUM, adcVoltage);
-
     // Unset the time stamp for the beginning of this measurement
     _millisMeasurementRequested = 0;
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
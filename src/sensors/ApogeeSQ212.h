@@ -208,6 +208,15 @@
 /// The assumed address of the ADS1115, 1001 000 (ADDR = GND)
 #define ADS1115_ADDRESS 0x48
 
+#ifdef MS_USE_ADS1015
+/// @brief The volts per ADC count at the 1x gain used; 2 mV for the ADS1015.
+#define SQ212_VOLTS_PER_COUNT 0.002
+#else
+/// @brief The volts per ADC count at the 1x gain used; 0.125 mV for the
+/// ADS1115.
+#define SQ212_VOLTS_PER_COUNT 0.000125
+#endif
+
 /**
  * @brief The Sensor sub-class for the [Apogee SQ-212](@ref sensor_sq212) sensor
  *
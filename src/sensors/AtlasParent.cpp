@@ -24,6 +24,7 @@ AtlasParent::AtlasParent(SoftwareWire* theI2C, int8_t powerPin,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = theI2C;
     createdSoftwareWire = false;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
 }
 AtlasParent::AtlasParent(int8_t powerPin, int8_t dataPin, int8_t clockPin,
                          uint8_t i2cAddressHex, uint8_t measurementsToAverage,
@@ -35,6 +36,7 @@ AtlasParent::AtlasParent(int8_t powerPin, int8_t dataPin, int8_t clockPin,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = new SoftwareWire(dataPin, clockPin);
     createdSoftwareWire = true;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
 }
 #else
 AtlasParent::AtlasParent(TwoWire* theI2C, int8_t powerPin,
@@ -46,6 +48,7 @@ AtlasParent::AtlasParent(TwoWire* theI2C, int8_t powerPin,
              measurementTime_ms, powerPin, -1, measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 AtlasParent::AtlasParent(int8_t powerPin, uint8_t i2cAddressHex,
                          uint8_t measurementsToAverage, const char* sensorName,
@@ -56,6 +59,7 @@ AtlasParent::AtlasParent(int8_t powerPin, uint8_t i2cAddressHex,
              measurementTime_ms, powerPin, -1, measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 #endif
 
@@ -152,6 +156,8 @@ bool AtlasParent::startSingleMeasurement(void) {
     MS_DBG(F("I2Cstatus:"), I2Cstatus);
     success &= !I2Cstatus;
     // NOTE: The return of 0 from endTransmission indicates success
+    // The circuit only acknowledges its address once it has warmed up
+    recordReadiness(success ? 1 : 0);
 
     if (success) {
         // Update the time that a measurement was requested
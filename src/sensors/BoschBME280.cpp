@@ -18,6 +18,7 @@ BoschBME280::BoschBME280(TwoWire* theI2C, int8_t powerPin,
              -1, measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 BoschBME280::BoschBME280(int8_t powerPin, uint8_t i2cAddressHex,
                          uint8_t measurementsToAverage)
@@ -26,6 +27,7 @@ BoschBME280::BoschBME280(int8_t powerPin, uint8_t i2cAddressHex,
              -1, measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 // Destructor
 BoschBME280::~BoschBME280() {}
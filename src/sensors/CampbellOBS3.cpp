@@ -12,6 +12,13 @@
 #include <Adafruit_ADS1015.h>
 
 
+// The voltage is proportional to the ADC counts, so it's only calculated once,
+// from the average count.  The turbidity calibration curve is not linear, so
+// it still has to be applied to each reading.
+static const rawResultCalibration obs3Calibration[] = {
+    {OBS3_VOLTAGE_VAR_NUM, OBS3_VOLTS_PER_COUNT, 0}};
+
+
 // The constructor - need the power pin, the data pin, and the calibration info
 CampbellOBS3::CampbellOBS3(int8_t powerPin, uint8_t adsChannel,
                            float x2_coeff_A, float x1_coeff_B, float x0_coeff_C,
@@ -24,6 +31,7 @@ CampbellOBS3::CampbellOBS3(int8_t powerPin, uint8_t adsChannel,
     _x1_coeff_B = x1_coeff_B;
     _x0_coeff_C = x0_coeff_C;
     _i2cAddress = i2cAddress;
+    setRawCalibration(obs3Calibration, 1);
 }
 // Destructor
 CampbellOBS3::~CampbellOBS3() {}
@@ -43,8 +51,11 @@ String CampbellOBS3::getSensorLocation(void) {
 
 
 bool CampbellOBS3::addSingleMeasurementResult(void) {
-    // Variables to store the results in
-    float adcVoltage  = -9999;
+    // The limits of a good reading, 3.6V and -0.3V, in ADC counts
+    const int16_t maxCount = 3.6 / OBS3_VOLTS_PER_COUNT;
+    const int16_t minCount = -0.3 / OBS3_VOLTS_PER_COUNT;
+    bool          success  = false;
+    // Variable to store the result in
     float calibResult = -9999;
 
     // Check a measurement was *successfully* started (status bit 6 set)
@@ -83,37 +94,51 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
 
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
-        // We're allowing the ADS1115 library to do the bit-to-volts conversion
-        // for us
-        adcVoltage =
-            ads.readADC_SingleEnded_V(_adsChannel);  // Getting the reading
-        MS_DBG(F("  ads.readADC_SingleEnded_V("), _adsChannel, F("):"),
-               adcVoltage);
-
-        if (adcVoltage < 3.6 && adcVoltage > -0.3) {
+        // The reading is kept in counts for the voltage; it's converted to
+        // volts here only for the turbidity.  A burst is reduced to a single
+        // count, which may not be an integer.
+        float adcCounts = -9999;
+        if (_burstSampler != NULL) {
+            _burstSampler->begin();
+            do {
+                int16_t burstCount = ads.readADC_SingleEnded(_adsChannel);
+                if (burstCount < maxCount && burstCount > minCount) {
+                    _burstSampler->addSample(burstCount);
+                }
+            } while (_burstSampler->waitForNextSample());
+            adcCounts = _burstSampler->reduce();
+            MS_DBG(F("  Reduced burst of ads.readADC_SingleEnded("),
+                   _adsChannel, F("):"), adcCounts);
+            addReducedRawResult(adcCounts);
+        } else {
+            int16_t singleCount = ads.readADC_SingleEnded(_adsChannel);
+            MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("):"),
+                   singleCount);
             // Skip results out of range
+            if (singleCount < maxCount && singleCount > minCount) {
+                addRawMeasurementResult(singleCount);
+                adcCounts = singleCount;
+            }
+        }
+
+        if (adcCounts != -9999) {
             // Apply the unique calibration curve for the given sensor
-            calibResult = (_x2_coeff_A * sq(adcVoltage)) +
+            float adcVoltage = adcCounts * OBS3_VOLTS_PER_COUNT;
+            calibResult      = (_x2_coeff_A * sq(adcVoltage)) +
                 (_x1_coeff_B * adcVoltage) + _x0_coeff_C;
             MS_DBG(F("  calibResult:"), calibResult);
-        } else {  // set invalid voltages back to -9999
-            adcVoltage = -9999;
+            success = true;
         }
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
     verifyAndAddMeasurementResult(OBS3_TURB_VAR_NUM, calibResult);
-    verifyAndAddMeasurementResult(OBS3_VOLTAGE_VAR_NUM, adcVoltage);
 
     // Unset the time stamp for the beginning of this measurement
     _millisMeasurementRequested = 0;
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
@@ -26,6 +26,13 @@ ExternalVoltage::ExternalVoltage(int8_t powerPin, uint8_t adsChannel,
     _adsChannel = adsChannel;
     _gain       = gain;
     _i2cAddress = i2cAddress;
+
+    // The readings are summed as ADC counts and converted to volts and
+    // multiplied by the gain only once, when they're averaged
+    _calibration.resultNumber = EXT_VOLTAGE_VAR_NUM;
+    _calibration.slope        = EXT_VOLTAGE_VOLTS_PER_COUNT * _gain;
+    _calibration.offset       = 0;
+    setRawCalibration(&_calibration, 1);
 }
 // Destructor
 ExternalVoltage::~ExternalVoltage() {}
@@ -45,9 +52,10 @@ String ExternalVoltage::getSensorLocation(void) {
 
 
 bool ExternalVoltage::addSingleMeasurementResult(void) {
-    // Variables to store the results in
-    float adcVoltage  = -9999;
-    float calibResult = -9999;
+    // The limits of a good reading, 3.6V and -0.3V, in ADC counts
+    const int16_t maxCount = 3.6 / EXT_VOLTAGE_VOLTS_PER_COUNT;
+    const int16_t minCount = -0.3 / EXT_VOLTAGE_VOLTS_PER_COUNT;
+    bool          success  = false;
 
     // Check a measurement was *successfully* started (status bit 6 set)
     // Only go on to get a result if it was
@@ -79,35 +87,42 @@ bool ExternalVoltage::addSingleMeasurementResult(void) {
 
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
-        // We're allowing the ADS1115 library to do the bit-to-volts conversion
-        // for us
-        adcVoltage =
-            ads.readADC_SingleEnded_V(_adsChannel);  // Getting the reading
-        MS_DBG(F("  ads.readADC_SingleEnded_V("), _adsChannel, F("):"),
-               adcVoltage);
-
-        if (adcVoltage < 3.6 && adcVoltage > -0.3) {
+        // The reading is kept in counts; the bit-to-volts conversion and the
+        // gain calculation, with a defualt gain of 10 V/V Gain, are applied
+        // to the average
+        if (_burstSampler != NULL) {
+            // Take the whole burst now and add its reduced value
+            _burstSampler->begin();
+            do {
+                int16_t adcCounts = ads.readADC_SingleEnded(_adsChannel);
+                if (adcCounts < maxCount && adcCounts > minCount) {
+                    _burstSampler->addSample(adcCounts);
+                }
+            } while (_burstSampler->waitForNextSample());
+            float burstCounts = _burstSampler->reduce();
+            MS_DBG(F("  Reduced burst of ads.readADC_SingleEnded("),
+                   _adsChannel, F("):"), burstCounts);
+            addReducedRawResult(burstCounts);
+            success = burstCounts != -9999;
+        } else {
+            int16_t adcCounts = ads.readADC_SingleEnded(_adsChannel);
+            MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("):"),
+                   adcCounts);
+
             // Skip results out of range
-            // Apply the gain calculation, with a defualt gain of 10 V/V Gain
-            calibResult = adcVoltage * _gain;
-            MS_DBG(F("  calibResult:"), calibResult);
-        } else {  // set invalid voltages back to -9999
-            adcVoltage = -9999;
+            if (adcCounts < maxCount && adcCounts > minCount) {
+                addRawMeasurementResult(adcCounts);
+                success = true;
+            }
         }
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
-    verifyAndAddMeasurementResult(EXT_VOLTAGE_VAR_NUM, calibResult);
-
     // Unset the time stamp for the beginning of this measurement
     _millisMeasurementRequested = 0;
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
@@ -235,6 +235,15 @@
 /// @brief The assumed address of the ADS1115, 1001 000 (ADDR = GND)
 #define ADS1115_ADDRESS 0x48
 
+#ifdef MS_USE_ADS1015
+/// @brief The volts per ADC count at the 1x gain used; 2 mV for the ADS1015.
+#define EXT_VOLTAGE_VOLTS_PER_COUNT 0.002
+#else
+/// @brief The volts per ADC count at the 1x gain used; 0.125 mV for the
+/// ADS1115.
+#define EXT_VOLTAGE_VOLTS_PER_COUNT 0.000125
+#endif
+
 /* clang-format off */
 /**
  * @brief The Sensor sub-class for the
@@ -288,6 +297,7 @@ class ExternalVoltage : public Sensor {
     uint8_t _adsChannel;
     float   _gain;
     uint8_t _i2cAddress;
+    rawResultCalibration _calibration;
 };
 
 
@@ -19,12 +19,14 @@ MPL115A2::MPL115A2(TwoWire* theI2C, int8_t powerPin,
              MPL115A2_STABILIZATION_TIME_MS, MPL115A2_MEASUREMENT_TIME_MS,
              powerPin, -1, measurementsToAverage) {
     _i2c = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 MPL115A2::MPL115A2(int8_t powerPin, uint8_t measurementsToAverage)
     : Sensor("MPL115A2", MPL115A2_NUM_VARIABLES, MPL115A2_WARM_UP_TIME_MS,
              MPL115A2_STABILIZATION_TIME_MS, MPL115A2_MEASUREMENT_TIME_MS,
              powerPin, -1, measurementsToAverage) {
     _i2c = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 // Destructor
 MPL115A2::~MPL115A2() {}
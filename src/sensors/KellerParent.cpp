@@ -22,7 +22,9 @@ KellerParent::KellerParent(byte modbusAddress, Stream* stream, int8_t powerPin,
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ksensor(), _model(model), _modbusAddress(modbusAddress), _stream(stream),
-      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setBus(SENSOR_BUS_MODBUS, _stream);
+}
 KellerParent::KellerParent(byte modbusAddress, Stream& stream, int8_t powerPin,
                            int8_t powerPin2, int8_t enablePin,
                            uint8_t measurementsToAverage, kellerModel model,
@@ -33,7 +35,9 @@ KellerParent::KellerParent(byte modbusAddress, Stream& stream, int8_t powerPin,
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ksensor(), _model(model), _modbusAddress(modbusAddress),
-      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setBus(SENSOR_BUS_MODBUS, _stream);
+}
 // Destructor
 KellerParent::~KellerParent() {}
 
@@ -71,13 +75,14 @@ void KellerParent::powerUp(void) {
     if (_powerPin >= 0) {
         MS_DBG(F("Powering"), getSensorNameAndLocation(), F("with pin"),
                _powerPin);
-        digitalWrite(_powerPin, HIGH);
-        // Mark the time that the sensor was powered
-        _millisPowerOn = millis();
+        _powerPinHandle.write(HIGH);
+        markPoweredOn();
     }
     if (_powerPin2 >= 0) {
         MS_DBG(F("Applying secondary power to"), getSensorNameAndLocation(),
                F("with pin"), _powerPin2);
+        // Set the pin mode, just in case
+        pinMode(_powerPin2, OUTPUT);
         digitalWrite(_powerPin2, HIGH);
     }
     if (_powerPin < 0 && _powerPin2 < 0) {
@@ -94,7 +99,7 @@ void KellerParent::powerDown(void) {
     if (_powerPin >= 0) {
         MS_DBG(F("Turning off power to"), getSensorNameAndLocation(),
                F("with pin"), _powerPin);
-        digitalWrite(_powerPin, LOW);
+        _powerPinHandle.write(LOW);
         // Unset the power-on time
         _millisPowerOn = 0;
         // Unset the activation time
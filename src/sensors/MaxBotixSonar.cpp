@@ -17,6 +17,7 @@ MaxBotixSonar::MaxBotixSonar(Stream* stream, int8_t powerPin, int8_t triggerPin,
              measurementsToAverage) {
     _triggerPin = triggerPin;
     _stream     = stream;
+    setBus(SENSOR_BUS_SERIAL, _stream);
 }
 MaxBotixSonar::MaxBotixSonar(Stream& stream, int8_t powerPin, int8_t triggerPin,
                              uint8_t measurementsToAverage)
@@ -25,6 +26,7 @@ MaxBotixSonar::MaxBotixSonar(Stream& stream, int8_t powerPin, int8_t triggerPin,
              measurementsToAverage) {
     _triggerPin = triggerPin;
     _stream     = &stream;
+    setBus(SENSOR_BUS_SERIAL, _stream);
 }
 // Destructor
 MaxBotixSonar::~MaxBotixSonar() {}
@@ -18,6 +18,7 @@ MaximDS18::MaximDS18(DeviceAddress OneWireAddress, int8_t powerPin,
              DS18_STABILIZATION_TIME_MS, DS18_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage),
       _internalOneWire(dataPin), _internalDallasTemp(&_internalOneWire) {
+    setBus(SENSOR_BUS_ONEWIRE, static_cast<uintptr_t>(dataPin));
     for (uint8_t i = 0; i < 8; i++) _OneWireAddress[i] = OneWireAddress[i];
     // _OneWireAddress = OneWireAddress;
     _addressKnown = true;
@@ -31,6 +32,7 @@ MaximDS18::MaximDS18(int8_t powerPin, int8_t dataPin,
              DS18_STABILIZATION_TIME_MS, DS18_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage),
       _internalOneWire(dataPin), _internalDallasTemp(&_internalOneWire) {
+    setBus(SENSOR_BUS_ONEWIRE, static_cast<uintptr_t>(dataPin));
     _addressKnown = false;
 }
 // Destructor
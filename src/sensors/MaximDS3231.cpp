@@ -9,12 +9,15 @@
 
 #include <Sodaq_DS3231.h>
 #include "MaximDS3231.h"
+#include <Wire.h>
 
 // Only input is the number of readings to average
 MaximDS3231::MaximDS3231(uint8_t measurementsToAverage)
     : Sensor("MaximDS3231", DS3231_NUM_VARIABLES, DS3231_WARM_UP_TIME_MS,
              DS3231_STABILIZATION_TIME_MS, DS3231_MEASUREMENT_TIME_MS, -1, -1,
-             measurementsToAverage) {}
+             measurementsToAverage) {
+    setBus(SENSOR_BUS_I2C, &Wire);
+}
 // Destructor
 MaximDS3231::~MaximDS3231() {}
 
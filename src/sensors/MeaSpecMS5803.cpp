@@ -10,6 +10,7 @@
  */
 
 #include "MeaSpecMS5803.h"
+#include <Wire.h>
 
 
 // The constructor - because this is I2C, only need the power pin
@@ -20,6 +21,7 @@ MeaSpecMS5803::MeaSpecMS5803(int8_t powerPin, uint8_t i2cAddressHex,
              -1, measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _maxPressure   = maxPressure;
+    setBus(SENSOR_BUS_I2C, &Wire);
 }
 // Destructor
 MeaSpecMS5803::~MeaSpecMS5803() {}
@@ -26,6 +26,7 @@ PaleoTerraRedox::PaleoTerraRedox(SoftwareWire* theI2C, int8_t powerPin,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = theI2C;
     createdSoftwareWire = false;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
 }
 PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, int8_t dataPin,
                                  int8_t clockPin, uint8_t i2cAddressHex,
@@ -36,6 +37,7 @@ PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, int8_t dataPin,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = new SoftwareWire(dataPin, clockPin);
     createdSoftwareWire = true;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
 }
 #else
 PaleoTerraRedox::PaleoTerraRedox(TwoWire* theI2C, int8_t powerPin,
@@ -46,6 +48,7 @@ PaleoTerraRedox::PaleoTerraRedox(TwoWire* theI2C, int8_t powerPin,
              measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, uint8_t i2cAddressHex,
                                  uint8_t measurementsToAverage)
@@ -54,6 +57,7 @@ PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, uint8_t i2cAddressHex,
              measurementsToAverage) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
 }
 #endif
 
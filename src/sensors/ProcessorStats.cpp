@@ -116,6 +116,37 @@ ProcessorStats::ProcessorStats(const char* version)
 #else
     _batteryPin         = -1;
 #endif
+
+    // The battery voltage is proportional to the ADC counts, so it's only
+    // calculated once, from the average count.  Boards and versions with an
+    // unknown battery divider get no calibration and report -9999.
+    float batterySlope = 0;
+#if defined(ARDUINO_AVR_ENVIRODIY_MAYFLY)
+    if (strcmp(_version, "v0.3") == 0 || strcmp(_version, "v0.4") == 0) {
+        batterySlope = (3.3 / 1023.) * 1.47;
+    }
+    if (strcmp(_version, "v0.5") == 0 || strcmp(_version, "v0.5b") == 0) {
+        batterySlope = (3.3 / 1023.) * 4.7;
+    }
+#elif defined(ARDUINO_AVR_FEATHER32U4) || defined(ARDUINO_SAMD_FEATHER_M0) || \
+    defined(ARDUINO_SAMD_FEATHER_M0_EXPRESS)
+    // we divided by 2, so multiply back, by 3.3V, our reference voltage
+    batterySlope = (3.3 / 1024.) * 2;
+#elif defined(ARDUINO_SODAQ_ONE) || defined(ARDUINO_SODAQ_ONE_BETA)
+    if (strcmp(_version, "v0.1") == 0) {
+        batterySlope = (3.3 / 1023.) * 2;
+    }
+    if (strcmp(_version, "v0.2") == 0) {
+        batterySlope = (3.3 / 1023.) * 1.47;
+    }
+#elif defined(ARDUINO_AVR_SODAQ_NDOGO) || defined(ARDUINO_SODAQ_AUTONOMO) || \
+    defined(ARDUINO_AVR_SODAQ_MBILI)
+    batterySlope = (3.3 / 1023.) * 1.47;
+#endif
+    _batteryCalibration.resultNumber = PROCESSOR_BATTERY_VAR_NUM;
+    _batteryCalibration.slope        = batterySlope;
+    _batteryCalibration.offset       = 0;
+    if (batterySlope > 0) setRawCalibration(&_batteryCalibration, 1);
 }
 // Destructor
 ProcessorStats::~ProcessorStats() {}
@@ -140,53 +171,10 @@ bool ProcessorStats::addSingleMeasurementResult(void) {
     // Get the battery voltage
     MS_DBG(F("Getting battery voltage"));
 
-    float sensorValue_battery = -9999;
-
-#if defined(ARDUINO_AVR_ENVIRODIY_MAYFLY)
-    if (strcmp(_version, "v0.3") == 0 || strcmp(_version, "v0.4") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
+    // The reading is kept in counts; it's converted to volts when averaged
+    if (_rawCalibrationCount > 0) {
+        addRawMeasurementResult(static_cast<int16_t>(analogRead(_batteryPin)));
     }
-    if (strcmp(_version, "v0.5") == 0 || strcmp(_version, "v0.5b") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 4.7 * rawBattery;
-    }
-
-#elif defined(ARDUINO_AVR_FEATHER32U4) || defined(ARDUINO_SAMD_FEATHER_M0) || \
-    defined(ARDUINO_SAMD_FEATHER_M0_EXPRESS)
-    float measuredvbat = analogRead(_batteryPin);
-    measuredvbat *= 2;     // we divided by 2, so multiply back
-    measuredvbat *= 3.3;   // Multiply by 3.3V, our reference voltage
-    measuredvbat /= 1024;  // convert to voltage
-    sensorValue_battery       = measuredvbat;
-
-#elif defined(ARDUINO_SODAQ_ONE) || defined(ARDUINO_SODAQ_ONE_BETA)
-    if (strcmp(_version, "v0.1") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 2 * rawBattery;
-    }
-    if (strcmp(_version, "v0.2") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
-    }
-
-#elif defined(ARDUINO_AVR_SODAQ_NDOGO) || defined(ARDUINO_SODAQ_AUTONOMO) || \
-    defined(ARDUINO_AVR_SODAQ_MBILI)
-    // Get the battery voltage
-    float rawBattery    = analogRead(_batteryPin);
-    sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
-
-#else
-    sensorValue_battery = -9999;
-
-#endif
-
-    verifyAndAddMeasurementResult(PROCESSOR_BATTERY_VAR_NUM,
-                                  sensorValue_battery);
 
     // Used only for debugging - can be removed
     MS_DBG(F("Getting Free RAM"));
@@ -234,6 +234,7 @@ class ProcessorStats : public Sensor {
     const char* _version;
     int8_t      _batteryPin;
     int16_t     sampNum;
+    rawResultCalibration _batteryCalibration;
 };
 
 
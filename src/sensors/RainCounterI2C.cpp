@@ -21,6 +21,7 @@ RainCounterI2C::RainCounterI2C(SoftwareWire* theI2C, uint8_t i2cAddressHex,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = theI2C;
     createdSoftwareWire = false;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
     _rainPerTip         = rainPerTip;
 }
 RainCounterI2C::RainCounterI2C(int8_t dataPin, int8_t clockPin,
@@ -31,6 +32,7 @@ RainCounterI2C::RainCounterI2C(int8_t dataPin, int8_t clockPin,
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = new SoftwareWire(dataPin, clockPin);
     createdSoftwareWire = true;
+    setBus(SENSOR_BUS_SOFTWARE_I2C, _i2c);
     _rainPerTip         = rainPerTip;
 }
 #else
@@ -41,6 +43,7 @@ RainCounterI2C::RainCounterI2C(TwoWire* theI2C, uint8_t i2cAddressHex,
              1) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
+    setBus(SENSOR_BUS_I2C, _i2c);
     _rainPerTip    = rainPerTip;
 }
 RainCounterI2C::RainCounterI2C(uint8_t i2cAddressHex, float rainPerTip)
@@ -49,6 +52,7 @@ RainCounterI2C::RainCounterI2C(uint8_t i2cAddressHex, float rainPerTip)
              1) {
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
+    setBus(SENSOR_BUS_I2C, _i2c);
     _rainPerTip    = rainPerTip;
 }
 #endif
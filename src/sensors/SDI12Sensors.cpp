@@ -25,6 +25,7 @@ SDI12Sensors::SDI12Sensors(char SDI12address, int8_t powerPin, int8_t dataPin,
     : Sensor(sensorName, numReturnedVars, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, dataPin, measurementsToAverage),
       _SDI12Internal(dataPin) {
+    setBus(SENSOR_BUS_SDI12, static_cast<uintptr_t>(dataPin));
     _SDI12address = SDI12address;
 }
 SDI12Sensors::SDI12Sensors(char* SDI12address, int8_t powerPin, int8_t dataPin,
@@ -37,6 +38,7 @@ SDI12Sensors::SDI12Sensors(char* SDI12address, int8_t powerPin, int8_t dataPin,
     : Sensor(sensorName, numReturnedVars, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, dataPin, measurementsToAverage),
       _SDI12Internal(dataPin) {
+    setBus(SENSOR_BUS_SDI12, static_cast<uintptr_t>(dataPin));
     _SDI12address = *SDI12address;
 }
 SDI12Sensors::SDI12Sensors(int SDI12address, int8_t powerPin, int8_t dataPin,
@@ -49,6 +51,7 @@ SDI12Sensors::SDI12Sensors(int SDI12address, int8_t powerPin, int8_t dataPin,
     : Sensor(sensorName, numReturnedVars, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, dataPin, measurementsToAverage),
       _SDI12Internal(dataPin) {
+    setBus(SENSOR_BUS_SDI12, static_cast<uintptr_t>(dataPin));
     _SDI12address = SDI12address + '0';
 }
 // Destructor
@@ -143,6 +146,8 @@ bool SDI12Sensors::requestSensorAcknowledgement(void) {
 
         ntries++;
     }
+    // The first acknowledgement shows when the sensor finished warming up
+    recordReadiness(didAcknowledge ? ntries : 0);
 
     return didAcknowledge;
 }
@@ -243,6 +248,28 @@ String SDI12Sensors::getSensorLocation(void) {
 }
 
 
+// To learn the warm-up time, the sensor must be asked for an acknowledgement
+// as soon as it is woken; otherwise there's nothing to do to wake it.
+bool SDI12Sensors::wake(void) {
+    // Sensor::wake() checks if the power pin is on and sets the wake timestamp
+    // and status bits.  If it returns false, there's no reason to go on.
+    if (!Sensor::wake()) return false;
+    if (!_adaptiveWarmUp) return true;
+
+    // Use begin() instead of just setActive() to ensure timer is set correctly.
+    if (!_SDI12Internal.isActive()) _SDI12Internal.begin();
+    if (!requestSensorAcknowledgement()) {
+        MS_DBG(getSensorNameAndLocation(), F("did not wake!"));
+        // Make sure the activation time is zero and the wake success bit (bit
+        // 4) is unset
+        _millisSensorActivated = 0;
+        _sensorStatus &= 0b11101111;
+        return false;
+    }
+    return true;
+}
+
+
 #ifndef MS_SDI12_NON_CONCURRENT
 // Sending the command to get a concurrent measurement
 bool SDI12Sensors::startSingleMeasurement(void) {
@@ -198,6 +198,16 @@ class SDI12Sensors : public Sensor {
      * @return **bool** True if the setup was successful.
      */
     bool setup(void) override;
+    /**
+     * @brief Wake the sensor up, if necessary.
+     *
+     * SDI-12 sensors wake on their own when they are spoken to, so this only
+     * checks that the sensor answers if its warm-up time is being learned; see
+     * Sensor::setAdaptiveWarmUp().
+     *
+     * @return **bool** True if the wake function completed successfully.
+     */
+    bool wake(void) override;
 
 // Only need this for concurrent measurements.
 // NOTE:  By default, concurrent measurements are used!
@@ -0,0 +1,70 @@
+/**
+ * @file SensorPhaseTiming.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the SensorPhaseTiming class.
+ */
+
+#include "SensorPhaseTiming.h"
+
+
+// The constructor - need the sensor to report on and the statistic
+SensorPhaseTiming::SensorPhaseTiming(Sensor*              profiledSensor,
+                                     phaseTimingStatistic statistic)
+    : Sensor("SensorPhaseTiming", PHASE_TIMING_NUM_VARIABLES,
+             PHASE_TIMING_WARM_UP_TIME_MS, PHASE_TIMING_STABILIZATION_TIME_MS,
+             PHASE_TIMING_MEASUREMENT_TIME_MS, -1, -1, 1) {
+    _profiledSensor = profiledSensor;
+    _statistic      = statistic;
+    nextPhaseTiming = NULL;
+    _profiledSensor->attachPhaseTiming(this);
+}
+// Destructor
+SensorPhaseTiming::~SensorPhaseTiming() {}
+
+
+String SensorPhaseTiming::getSensorLocation(void) {
+    String sensorLocation = _profiledSensor->getSensorNameAndLocation();
+    switch (_statistic) {
+        case PHASE_TIMING_MIN: sensorLocation += F("_min"); break;
+        case PHASE_TIMING_MAX: sensorLocation += F("_max"); break;
+        default: sensorLocation += F("_mean"); break;
+    }
+    return sensorLocation;
+}
+
+
+bool SensorPhaseTiming::addSingleMeasurementResult(void) {
+    // Unset the time stamp for the beginning of this measurement
+    _millisMeasurementRequested = 0;
+    // Unset the status bits for a measurement request (bits 5 & 6)
+    _sensorStatus &= 0b10011111;
+
+    // Return true when finished
+    return true;
+}
+
+
+void SensorPhaseTiming::publishTiming(void) {
+    MS_DBG(F("Timing profile of"), _profiledSensor->getSensorNameAndLocation(),
+           F("from"), _profiledSensor->getPhaseCount(SENSOR_PHASE_WARM_UP),
+           F("updates"));
+    clearValues();
+    // The getters return -9999 if nothing has been recorded
+    for (uint8_t p = 0; p < SENSOR_PHASE_COUNT; p++) {
+        sensorPhase phase = static_cast<sensorPhase>(p);
+        float       duration;
+        switch (_statistic) {
+            case PHASE_TIMING_MIN:
+                duration = _profiledSensor->getPhaseMin(phase);
+                break;
+            case PHASE_TIMING_MAX:
+                duration = _profiledSensor->getPhaseMax(phase);
+                break;
+            default: duration = _profiledSensor->getPhaseMean(phase); break;
+        }
+        verifyAndAddMeasurementResult(p, duration);
+    }
+    notifyVariables();
+}
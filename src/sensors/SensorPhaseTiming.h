@@ -0,0 +1,415 @@
+/**
+ * @file SensorPhaseTiming.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the SensorPhaseTiming sensor subclass and the variable
+ * subclasses SensorPhaseTiming_WarmUp, SensorPhaseTiming_Wake,
+ * SensorPhaseTiming_Stabilization, SensorPhaseTiming_Measurement, and
+ * SensorPhaseTiming_Result.
+ *
+ * These are diagnostics on how long another sensor spends in each phase of an
+ * update.
+ */
+/* clang-format off */
+/**
+ * @defgroup sensor_phase_timing Sensor Phase Timing
+ * Classes for reporting the timing profile of another sensor.
+ *
+ * @ingroup the_sensors
+ *
+ * @tableofcontents
+ * @m_footernavigation
+ *
+ * @section sensor_phase_timing_intro Introduction
+ *
+ * When the library is built with `-D MS_CHECK_SENSOR_TIMING`, every sensor
+ * keeps the durations of the phases of its last few updates: warm-up, wake,
+ * stabilization, measurement, and result retrieval.  The timings are recorded
+ * by VariableArray::completeUpdate().  Attaching a SensorPhaseTiming object to
+ * a sensor reports the minimum, mean, or maximum duration of every phase of
+ * that sensor so the timing can be logged and sent along with the rest of the
+ * data.  Attach one object for each of the statistics wanted.  This is meant
+ * for tuning the warm-up, stabilization, and measurement times of sensors and
+ * for spotting sensors whose timing changes in the field.  To see all of the
+ * phases of all of the sensors at once, use
+ * VariableArray::printSensorTiming().
+ *
+ * The durations are handed over by the profiled sensor when it finishes
+ * averaging, so they always include the timing of the same update as its
+ * values.
+ *
+ * @note The timing profile is only kept if `MS_CHECK_SENSOR_TIMING` is defined
+ * as a build flag for the whole library; defining it in a sketch is not
+ * enough.  Without it, all of the values will be -9999.
+ *
+ * @section sensor_phase_timing_ctor Sensor Constructor
+ * {{ @ref SensorPhaseTiming::SensorPhaseTiming }}
+ */
+/* clang-format on */
+
+// Header Guards
+#ifndef SRC_SENSORS_SENSORPHASETIMING_H_
+#define SRC_SENSORS_SENSORPHASETIMING_H_
+
+// Debugging Statement
+// #define MS_SENSORPHASETIMING_DEBUG
+
+#ifdef MS_SENSORPHASETIMING_DEBUG
+#define MS_DEBUGGING_STD "SensorPhaseTiming"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "VariableBase.h"
+#include "SensorBase.h"
+
+// Sensor Specific Defines
+/** @ingroup sensor_phase_timing */
+/**@{*/
+
+/// @brief Sensor::_numReturnedValues; the timing profile can report one value
+/// for each of the 5 phases.
+#define PHASE_TIMING_NUM_VARIABLES SENSOR_PHASE_COUNT
+
+/**
+ * @anchor sensor_phase_timing_timing
+ * @name Sensor Timing
+ * The sensor timing for the phase timing profile
+ * - The profile is already in memory, there is no waiting.
+ */
+/**@{*/
+/// @brief Sensor::_warmUpTime_ms; no warm up is needed.
+#define PHASE_TIMING_WARM_UP_TIME_MS 0
+/// @brief Sensor::_stabilizationTime_ms; no stabilization is needed.
+#define PHASE_TIMING_STABILIZATION_TIME_MS 0
+/// @brief Sensor::_measurementTime_ms; the profile is read immediately.
+#define PHASE_TIMING_MEASUREMENT_TIME_MS 0
+/**@}*/
+
+/**
+ * @anchor sensor_phase_timing_durations
+ * @name Phase Durations
+ * The minimum, mean, or maximum duration of each phase in the profile
+ * - Resolution is 1 ms, averaged to 0.1 ms for the mean
+ *
+ * {{ @ref SensorPhaseTiming_WarmUp::SensorPhaseTiming_WarmUp }}
+ * {{ @ref SensorPhaseTiming_Wake::SensorPhaseTiming_Wake }}
+ * {{ @ref SensorPhaseTiming_Stabilization::SensorPhaseTiming_Stabilization }}
+ * {{ @ref SensorPhaseTiming_Measurement::SensorPhaseTiming_Measurement }}
+ * {{ @ref SensorPhaseTiming_Result::SensorPhaseTiming_Result }}
+ */
+/**@{*/
+/// @brief Decimals places in string representation; the mean should have 1.
+#define PHASE_TIMING_RESOLUTION 1
+/// @brief The warm-up duration is stored in sensorValues[0]
+#define PHASE_TIMING_WARM_UP_VAR_NUM SENSOR_PHASE_WARM_UP
+/// @brief The wake duration is stored in sensorValues[1]
+#define PHASE_TIMING_WAKE_VAR_NUM SENSOR_PHASE_WAKE
+/// @brief The stabilization duration is stored in sensorValues[2]
+#define PHASE_TIMING_STABILIZATION_VAR_NUM SENSOR_PHASE_STABILIZATION
+/// @brief The measurement duration is stored in sensorValues[3]
+#define PHASE_TIMING_MEASUREMENT_VAR_NUM SENSOR_PHASE_MEASUREMENT
+/// @brief The result retrieval duration is stored in sensorValues[4]
+#define PHASE_TIMING_RESULT_VAR_NUM SENSOR_PHASE_RESULT
+/// @brief Variable name in
+/// [ODM2 controlled vocabulary](http://vocabulary.odm2.org/variablename/);
+/// "timeElapsed"
+#define PHASE_TIMING_VAR_NAME "timeElapsed"
+/// @brief Variable unit name in
+/// [ODM2 controlled vocabulary](http://vocabulary.odm2.org/units/);
+/// "millisecond"
+#define PHASE_TIMING_UNIT_NAME "millisecond"
+/// @brief Default variable short code; "warmUpMs"
+#define PHASE_TIMING_WARM_UP_DEFAULT_CODE "warmUpMs"
+/// @brief Default variable short code; "wakeMs"
+#define PHASE_TIMING_WAKE_DEFAULT_CODE "wakeMs"
+/// @brief Default variable short code; "stabilizationMs"
+#define PHASE_TIMING_STABILIZATION_DEFAULT_CODE "stabilizationMs"
+/// @brief Default variable short code; "measurementMs"
+#define PHASE_TIMING_MEASUREMENT_DEFAULT_CODE "measurementMs"
+/// @brief Default variable short code; "resultMs"
+#define PHASE_TIMING_RESULT_DEFAULT_CODE "resultMs"
+/**@}*/
+
+/**
+ * @brief The statistic of the phase durations in the timing profile to report.
+ */
+typedef enum phaseTimingStatistic {
+    PHASE_TIMING_MIN = 0,  ///< The shortest duration
+    PHASE_TIMING_MEAN,     ///< The mean duration
+    PHASE_TIMING_MAX       ///< The longest duration
+} phaseTimingStatistic;
+
+
+/**
+ * @brief The main class to report the timing profile of every phase of
+ * another sensor.
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming : public Sensor {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming object and attach it to the
+     * profiled sensor.
+     *
+     * @param profiledSensor The sensor whose timing profile to report.
+     * @param statistic The statistic of the durations to report; optional with
+     * a default value of PHASE_TIMING_MEAN.
+     */
+    explicit SensorPhaseTiming(
+        Sensor*              profiledSensor,
+        phaseTimingStatistic statistic = PHASE_TIMING_MEAN);
+    /**
+     * @brief Destroy the SensorPhaseTiming object
+     */
+    ~SensorPhaseTiming();
+
+    /**
+     * @copydoc Sensor::getSensorLocation()
+     *
+     * This returns the name and location of the profiled sensor and the
+     * statistic.
+     */
+    String getSensorLocation(void) override;
+
+    /**
+     * @copydoc Sensor::addSingleMeasurementResult()
+     *
+     * The durations are handed over by the profiled sensor when it finishes
+     * averaging, so this does not add anything.
+     */
+    bool addSingleMeasurementResult(void) override;
+
+    /**
+     * @brief Put the statistic of each phase into the values array and notify
+     * the attached variables.
+     */
+    void publishTiming(void);
+
+    /**
+     * @brief The next phase timing object attached to the same profiled
+     * sensor; the profiled sensor keeps them as a linked list.
+     */
+    SensorPhaseTiming* nextPhaseTiming;
+
+ private:
+    Sensor*              _profiledSensor;
+    phaseTimingStatistic _statistic;
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [duration of the warm-up](@ref sensor_phase_timing_durations).
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming_WarmUp : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming_WarmUp object.
+     *
+     * @param parentSense The parent SensorPhaseTiming providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "warmUpMs".
+     */
+    explicit SensorPhaseTiming_WarmUp(
+        SensorPhaseTiming* parentSense, const char* uuid = "",
+        const char* varCode = PHASE_TIMING_WARM_UP_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)PHASE_TIMING_WARM_UP_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorPhaseTiming_WarmUp object.
+     *
+     * @note This must be tied with a parent SensorPhaseTiming before it can be
+     * used.
+     */
+    SensorPhaseTiming_WarmUp()
+        : Variable((const uint8_t)PHASE_TIMING_WARM_UP_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME,
+                   PHASE_TIMING_WARM_UP_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorPhaseTiming_WarmUp object - no action needed.
+     */
+    ~SensorPhaseTiming_WarmUp() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [duration of the wake() function](@ref sensor_phase_timing_durations).
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming_Wake : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming_Wake object.
+     *
+     * @param parentSense The parent SensorPhaseTiming providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "wakeMs".
+     */
+    explicit SensorPhaseTiming_Wake(
+        SensorPhaseTiming* parentSense, const char* uuid = "",
+        const char* varCode = PHASE_TIMING_WAKE_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)PHASE_TIMING_WAKE_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorPhaseTiming_Wake object.
+     *
+     * @note This must be tied with a parent SensorPhaseTiming before it can be
+     * used.
+     */
+    SensorPhaseTiming_Wake()
+        : Variable((const uint8_t)PHASE_TIMING_WAKE_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, PHASE_TIMING_WAKE_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorPhaseTiming_Wake object - no action needed.
+     */
+    ~SensorPhaseTiming_Wake() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [duration of the stabilization](@ref sensor_phase_timing_durations).
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming_Stabilization : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming_Stabilization object.
+     *
+     * @param parentSense The parent SensorPhaseTiming providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "stabilizationMs".
+     */
+    explicit SensorPhaseTiming_Stabilization(
+        SensorPhaseTiming* parentSense, const char* uuid = "",
+        const char* varCode = PHASE_TIMING_STABILIZATION_DEFAULT_CODE)
+        : Variable(parentSense,
+                   (const uint8_t)PHASE_TIMING_STABILIZATION_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorPhaseTiming_Stabilization object.
+     *
+     * @note This must be tied with a parent SensorPhaseTiming before it can be
+     * used.
+     */
+    SensorPhaseTiming_Stabilization()
+        : Variable((const uint8_t)PHASE_TIMING_STABILIZATION_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME,
+                   PHASE_TIMING_STABILIZATION_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorPhaseTiming_Stabilization object - no action
+     * needed.
+     */
+    ~SensorPhaseTiming_Stabilization() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [duration of a measurement](@ref sensor_phase_timing_durations).
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming_Measurement : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming_Measurement object.
+     *
+     * @param parentSense The parent SensorPhaseTiming providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "measurementMs".
+     */
+    explicit SensorPhaseTiming_Measurement(
+        SensorPhaseTiming* parentSense, const char* uuid = "",
+        const char* varCode = PHASE_TIMING_MEASUREMENT_DEFAULT_CODE)
+        : Variable(parentSense,
+                   (const uint8_t)PHASE_TIMING_MEASUREMENT_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorPhaseTiming_Measurement object.
+     *
+     * @note This must be tied with a parent SensorPhaseTiming before it can be
+     * used.
+     */
+    SensorPhaseTiming_Measurement()
+        : Variable((const uint8_t)PHASE_TIMING_MEASUREMENT_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME,
+                   PHASE_TIMING_MEASUREMENT_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorPhaseTiming_Measurement object - no action
+     * needed.
+     */
+    ~SensorPhaseTiming_Measurement() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [duration of getting a result](@ref sensor_phase_timing_durations).
+ *
+ * @ingroup sensor_phase_timing
+ */
+class SensorPhaseTiming_Result : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorPhaseTiming_Result object.
+     *
+     * @param parentSense The parent SensorPhaseTiming providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "resultMs".
+     */
+    explicit SensorPhaseTiming_Result(
+        SensorPhaseTiming* parentSense, const char* uuid = "",
+        const char* varCode = PHASE_TIMING_RESULT_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)PHASE_TIMING_RESULT_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorPhaseTiming_Result object.
+     *
+     * @note This must be tied with a parent SensorPhaseTiming before it can be
+     * used.
+     */
+    SensorPhaseTiming_Result()
+        : Variable((const uint8_t)PHASE_TIMING_RESULT_VAR_NUM,
+                   (uint8_t)PHASE_TIMING_RESOLUTION, PHASE_TIMING_VAR_NAME,
+                   PHASE_TIMING_UNIT_NAME, PHASE_TIMING_RESULT_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorPhaseTiming_Result object - no action needed.
+     */
+    ~SensorPhaseTiming_Result() {}
+};
+/**@}*/
+#endif  // SRC_SENSORS_SENSORPHASETIMING_H_
@@ -0,0 +1,83 @@
+/**
+ * @file SensorStatistics.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the SensorStatistics class.
+ */
+
+#include "SensorStatistics.h"
+
+
+// The constructor - need the sensor to keep statistics on and the result
+SensorStatistics::SensorStatistics(Sensor* measuredSensor,
+                                   uint8_t resultNumber)
+    : Sensor("SensorStatistics", STATISTICS_NUM_VARIABLES,
+             STATISTICS_WARM_UP_TIME_MS, STATISTICS_STABILIZATION_TIME_MS,
+             STATISTICS_MEASUREMENT_TIME_MS, -1, -1, 1) {
+    _measuredSensor = measuredSensor;
+    _resultNumber   = resultNumber;
+    nextStatistics  = NULL;
+    resetStatistics();
+    _measuredSensor->attachStatistics(this);
+}
+// Destructor
+SensorStatistics::~SensorStatistics() {}
+
+
+String SensorStatistics::getSensorLocation(void) {
+    String sensorLocation = _measuredSensor->getSensorNameAndLocation();
+    sensorLocation += '_';
+    sensorLocation += String(_resultNumber);
+    return sensorLocation;
+}
+
+
+bool SensorStatistics::addSingleMeasurementResult(void) {
+    // Unset the time stamp for the beginning of this measurement
+    _millisMeasurementRequested = 0;
+    // Unset the status bits for a measurement request (bits 5 & 6)
+    _sensorStatus &= 0b10011111;
+
+    // Return true when finished
+    return true;
+}
+
+
+void SensorStatistics::resetStatistics(void) {
+    _count = 0;
+    _mean  = 0;
+    _m2    = 0;
+    _min   = -9999;
+    _max   = -9999;
+}
+
+
+// Welford's method; the sum of squared differences from the mean is kept
+// without ever summing the squares themselves, so it stays accurate in a float
+void SensorStatistics::addSample(uint8_t resultNumber, float resultValue) {
+    if (resultNumber != _resultNumber) return;
+    if (_count == 0 || resultValue < _min) _min = resultValue;
+    if (_count == 0 || resultValue > _max) _max = resultValue;
+    _count++;
+    float delta = resultValue - _mean;
+    _mean += delta / _count;
+    _m2 += delta * (resultValue - _mean);
+}
+
+
+void SensorStatistics::publishStatistics(void) {
+    MS_DBG(F("Statistics of result"), _resultNumber, F("from"),
+           _measuredSensor->getSensorNameAndLocation(), F("over"), _count,
+           F("good reading[s]"));
+    clearValues();
+    verifyAndAddMeasurementResult(STATISTICS_MIN_VAR_NUM, _min);
+    verifyAndAddMeasurementResult(STATISTICS_MAX_VAR_NUM, _max);
+    if (_count > 1) {
+        verifyAndAddMeasurementResult(STATISTICS_STDDEV_VAR_NUM,
+                                      sqrt(_m2 / (_count - 1)));
+    }
+    verifyAndAddMeasurementResult(STATISTICS_COUNT_VAR_NUM,
+                                  static_cast<float>(_count));
+    notifyVariables();
+}
@@ -0,0 +1,387 @@
+/**
+ * @file SensorStatistics.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the SensorStatistics sensor subclass and the variable
+ * subclasses SensorStatistics_Min, SensorStatistics_Max,
+ * SensorStatistics_StdDev, and SensorStatistics_Count.
+ *
+ * These report the spread of the measurements another sensor averages into
+ * one of its results.
+ */
+/* clang-format off */
+/**
+ * @defgroup sensor_statistics Sensor Statistics
+ * Classes for reporting the spread of the measurements averaged by another
+ * sensor.
+ *
+ * @ingroup the_sensors
+ *
+ * @tableofcontents
+ * @m_footernavigation
+ *
+ * @section sensor_statistics_intro Introduction
+ *
+ * When a sensor is set to average several measurements, only the mean of them
+ * is normally kept.  Attaching a SensorStatistics object to one result of the
+ * sensor keeps a running (Welford) tally of every good measurement of that
+ * result in an update, so the minimum, maximum, standard deviation, and number
+ * of good measurements behind the mean can be logged and sent along with the
+ * rest of the data.  This is meant for noisy measurements, like turbidity or
+ * sonar ranges, where the variability within the averaging burst is useful
+ * information on its own.
+ *
+ * The statistics are handed over by the sensor being measured when it
+ * finishes averaging, so they always describe the same update as its mean.
+ * The standard deviation is the sample standard deviation; it is -9999 if
+ * fewer than two good measurements were made.
+ *
+ * @note Each SensorStatistics object uses about 30 bytes of RAM in addition
+ * to the variables; sensors without any attached statistics use none.
+ *
+ * @section sensor_statistics_ctor Sensor Constructor
+ * {{ @ref SensorStatistics::SensorStatistics }}
+ */
+/* clang-format on */
+
+// Header Guards
+#ifndef SRC_SENSORS_SENSORSTATISTICS_H_
+#define SRC_SENSORS_SENSORSTATISTICS_H_
+
+// Debugging Statement
+// #define MS_SENSORSTATISTICS_DEBUG
+
+#ifdef MS_SENSORSTATISTICS_DEBUG
+#define MS_DEBUGGING_STD "SensorStatistics"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "VariableBase.h"
+#include "SensorBase.h"
+
+// Sensor Specific Defines
+/** @ingroup sensor_statistics */
+/**@{*/
+
+/// @brief Sensor::_numReturnedValues; the statistics can report 4 values.
+#define STATISTICS_NUM_VARIABLES 4
+
+/**
+ * @anchor sensor_statistics_timing
+ * @name Sensor Timing
+ * The sensor timing for the statistics
+ * - The statistics are already in memory, there is no waiting.
+ */
+/**@{*/
+/// @brief Sensor::_warmUpTime_ms; no warm up is needed.
+#define STATISTICS_WARM_UP_TIME_MS 0
+/// @brief Sensor::_stabilizationTime_ms; no stabilization is needed.
+#define STATISTICS_STABILIZATION_TIME_MS 0
+/// @brief Sensor::_measurementTime_ms; the statistics are read immediately.
+#define STATISTICS_MEASUREMENT_TIME_MS 0
+/**@}*/
+
+/**
+ * @anchor sensor_statistics_spread
+ * @name Spread
+ * The minimum, maximum, and standard deviation of the averaged measurements
+ * - Range and resolution are those of the result of the measured sensor; the
+ * resolution of the variable should be set to match.
+ *
+ * {{ @ref SensorStatistics_Min::SensorStatistics_Min }}
+ * {{ @ref SensorStatistics_Max::SensorStatistics_Max }}
+ * {{ @ref SensorStatistics_StdDev::SensorStatistics_StdDev }}
+ */
+/**@{*/
+/// @brief Default decimals places in string representation; 3.
+#define STATISTICS_RESOLUTION 3
+/// @brief The minimum is stored in sensorValues[0]
+#define STATISTICS_MIN_VAR_NUM 0
+/// @brief The maximum is stored in sensorValues[1]
+#define STATISTICS_MAX_VAR_NUM 1
+/// @brief The standard deviation is stored in sensorValues[2]
+#define STATISTICS_STDDEV_VAR_NUM 2
+/// @brief Variable name in
+/// [ODM2 controlled vocabulary](http://vocabulary.odm2.org/variablename/);
+/// "variable"; the spread is of whatever the measured sensor reports.
+#define STATISTICS_VAR_NAME "variable"
+/// @brief Variable unit name; the unit of the measured result.
+#define STATISTICS_UNIT_NAME "unknown"
+/// @brief Default variable short code; "statMin"
+#define STATISTICS_MIN_DEFAULT_CODE "statMin"
+/// @brief Default variable short code; "statMax"
+#define STATISTICS_MAX_DEFAULT_CODE "statMax"
+/// @brief Default variable short code; "statStdDev"
+#define STATISTICS_STDDEV_DEFAULT_CODE "statStdDev"
+/**@}*/
+
+/**
+ * @anchor sensor_statistics_count
+ * @name Count
+ * The number of good measurements averaged
+ * - Range is 0 to the number of measurements to average.
+ *
+ * {{ @ref SensorStatistics_Count::SensorStatistics_Count }}
+ */
+/**@{*/
+/// @brief Decimals places in string representation; the count should have 0.
+#define STATISTICS_COUNT_RESOLUTION 0
+/// @brief The count is stored in sensorValues[3]
+#define STATISTICS_COUNT_VAR_NUM 3
+/// @brief Variable name in
+/// [ODM2 controlled vocabulary](http://vocabulary.odm2.org/variablename/);
+/// "counter"
+#define STATISTICS_COUNT_VAR_NAME "counter"
+/// @brief Variable unit name in
+/// [ODM2 controlled vocabulary](http://vocabulary.odm2.org/units/); "count"
+#define STATISTICS_COUNT_UNIT_NAME "count"
+/// @brief Default variable short code; "statCount"
+#define STATISTICS_COUNT_DEFAULT_CODE "statCount"
+/**@}*/
+
+
+/**
+ * @brief The main class to report the statistics of the measurements averaged
+ * into one result of another sensor.
+ *
+ * @ingroup sensor_statistics
+ */
+class SensorStatistics : public Sensor {
+ public:
+    /**
+     * @brief Construct a new SensorStatistics object and attach it to the
+     * measured sensor.
+     *
+     * @param measuredSensor The sensor whose measurements to keep statistics
+     * on.
+     * @param resultNumber The position of the result within the result array
+     * of the measured sensor; this is the same as the variable number of the
+     * result.
+     */
+    SensorStatistics(Sensor* measuredSensor, uint8_t resultNumber);
+    /**
+     * @brief Destroy the SensorStatistics object
+     */
+    ~SensorStatistics();
+
+    /**
+     * @copydoc Sensor::getSensorLocation()
+     *
+     * This returns the name and location of the measured sensor and the result
+     * number.
+     */
+    String getSensorLocation(void) override;
+
+    /**
+     * @copydoc Sensor::addSingleMeasurementResult()
+     *
+     * The statistics are handed over by the measured sensor when it finishes
+     * averaging, so this does not add anything.
+     */
+    bool addSingleMeasurementResult(void) override;
+
+    /**
+     * @brief Forget all of the measurements tallied so far.
+     */
+    void resetStatistics(void);
+    /**
+     * @brief Add one good measurement to the tally.
+     *
+     * @param resultNumber The position of the result within the result array
+     * of the measured sensor; other results are ignored.
+     * @param resultValue The value of the result.
+     */
+    void addSample(uint8_t resultNumber, float resultValue);
+    /**
+     * @brief Put the tallied statistics into the values array and notify the
+     * attached variables.
+     */
+    void publishStatistics(void);
+
+    /**
+     * @brief The next statistics object attached to the same measured sensor;
+     * the measured sensor keeps them as a linked list.
+     */
+    SensorStatistics* nextStatistics;
+
+ private:
+    Sensor* _measuredSensor;
+    uint8_t _resultNumber;
+    uint8_t _count;
+    float   _mean;
+    float   _m2;
+    float   _min;
+    float   _max;
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [minimum](@ref sensor_statistics_spread) of the averaged measurements.
+ *
+ * @ingroup sensor_statistics
+ */
+class SensorStatistics_Min : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorStatistics_Min object.
+     *
+     * @param parentSense The parent SensorStatistics providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "statMin".
+     */
+    explicit SensorStatistics_Min(
+        SensorStatistics* parentSense, const char* uuid = "",
+        const char* varCode = STATISTICS_MIN_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)STATISTICS_MIN_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorStatistics_Min object.
+     *
+     * @note This must be tied with a parent SensorStatistics before it can be
+     * used.
+     */
+    SensorStatistics_Min()
+        : Variable((const uint8_t)STATISTICS_MIN_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, STATISTICS_MIN_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorStatistics_Min object - no action needed.
+     */
+    ~SensorStatistics_Min() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [maximum](@ref sensor_statistics_spread) of the averaged measurements.
+ *
+ * @ingroup sensor_statistics
+ */
+class SensorStatistics_Max : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorStatistics_Max object.
+     *
+     * @param parentSense The parent SensorStatistics providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "statMax".
+     */
+    explicit SensorStatistics_Max(
+        SensorStatistics* parentSense, const char* uuid = "",
+        const char* varCode = STATISTICS_MAX_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)STATISTICS_MAX_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorStatistics_Max object.
+     *
+     * @note This must be tied with a parent SensorStatistics before it can be
+     * used.
+     */
+    SensorStatistics_Max()
+        : Variable((const uint8_t)STATISTICS_MAX_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, STATISTICS_MAX_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorStatistics_Max object - no action needed.
+     */
+    ~SensorStatistics_Max() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [standard deviation](@ref sensor_statistics_spread) of the averaged
+ * measurements.
+ *
+ * @ingroup sensor_statistics
+ */
+class SensorStatistics_StdDev : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorStatistics_StdDev object.
+     *
+     * @param parentSense The parent SensorStatistics providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "statStdDev".
+     */
+    explicit SensorStatistics_StdDev(
+        SensorStatistics* parentSense, const char* uuid = "",
+        const char* varCode = STATISTICS_STDDEV_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)STATISTICS_STDDEV_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorStatistics_StdDev object.
+     *
+     * @note This must be tied with a parent SensorStatistics before it can be
+     * used.
+     */
+    SensorStatistics_StdDev()
+        : Variable((const uint8_t)STATISTICS_STDDEV_VAR_NUM,
+                   (uint8_t)STATISTICS_RESOLUTION, STATISTICS_VAR_NAME,
+                   STATISTICS_UNIT_NAME, STATISTICS_STDDEV_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorStatistics_StdDev object - no action needed.
+     */
+    ~SensorStatistics_StdDev() {}
+};
+
+
+/**
+ * @brief The Variable sub-class used for the
+ * [number of good measurements](@ref sensor_statistics_count) averaged.
+ *
+ * @ingroup sensor_statistics
+ */
+class SensorStatistics_Count : public Variable {
+ public:
+    /**
+     * @brief Construct a new SensorStatistics_Count object.
+     *
+     * @param parentSense The parent SensorStatistics providing the result
+     * values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "statCount".
+     */
+    explicit SensorStatistics_Count(
+        SensorStatistics* parentSense, const char* uuid = "",
+        const char* varCode = STATISTICS_COUNT_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)STATISTICS_COUNT_VAR_NUM,
+                   (uint8_t)STATISTICS_COUNT_RESOLUTION,
+                   STATISTICS_COUNT_VAR_NAME, STATISTICS_COUNT_UNIT_NAME,
+                   varCode, uuid) {}
+    /**
+     * @brief Construct a new SensorStatistics_Count object.
+     *
+     * @note This must be tied with a parent SensorStatistics before it can be
+     * used.
+     */
+    SensorStatistics_Count()
+        : Variable((const uint8_t)STATISTICS_COUNT_VAR_NUM,
+                   (uint8_t)STATISTICS_COUNT_RESOLUTION,
+                   STATISTICS_COUNT_VAR_NAME, STATISTICS_COUNT_UNIT_NAME,
+                   STATISTICS_COUNT_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the SensorStatistics_Count object - no action needed.
+     */
+    ~SensorStatistics_Count() {}
+};
+/**@}*/
+#endif  // SRC_SENSORS_SENSORSTATISTICS_H_
@@ -9,6 +9,7 @@
  */
 
 #include "TallyCounterI2C.h"
+#include <Wire.h>
 
 
 // The constructor
@@ -17,6 +18,7 @@ TallyCounterI2C::TallyCounterI2C(int8_t powerPin, uint8_t i2cAddressHex)
              TALLY_STABILIZATION_TIME_MS, TALLY_MEASUREMENT_TIME_MS, powerPin,
              -1, 1) {
     _i2cAddressHex = i2cAddressHex;
+    setBus(SENSOR_BUS_I2C, &Wire);
 }
 // Destructor
 TallyCounterI2C::~TallyCounterI2C() {}
@@ -19,7 +19,9 @@ YosemitechParent::YosemitechParent(
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ysensor(), _model(model), _modbusAddress(modbusAddress), _stream(stream),
-      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setBus(SENSOR_BUS_MODBUS, _stream);
+}
 YosemitechParent::YosemitechParent(
     byte modbusAddress, Stream& stream, int8_t powerPin, int8_t powerPin2,
     int8_t enablePin, uint8_t measurementsToAverage, yosemitechModel model,
@@ -28,7 +30,9 @@ YosemitechParent::YosemitechParent(
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ysensor(), _model(model), _modbusAddress(modbusAddress),
-      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setBus(SENSOR_BUS_MODBUS, _stream);
+}
 // Destructor
 YosemitechParent::~YosemitechParent() {}
 
@@ -78,6 +82,8 @@ bool YosemitechParent::wake(void) {
         success = _ysensor.startMeasurement();
         ntries++;
     }
+    // The first Modbus reply shows when the sensor finished warming up
+    recordReadiness(success ? ntries : 0);
 
     if (success) {
         // Update the time that the sensor was activated
@@ -146,13 +152,14 @@ void YosemitechParent::powerUp(void) {
     if (_powerPin >= 0) {
         MS_DBG(F("Powering"), getSensorNameAndLocation(), F("with pin"),
                _powerPin);
-        digitalWrite(_powerPin, HIGH);
-        // Mark the time that the sensor was powered
-        _millisPowerOn = millis();
+        _powerPinHandle.write(HIGH);
+        markPoweredOn();
     }
     if (_powerPin2 >= 0) {
         MS_DBG(F("Applying secondary power to"), getSensorNameAndLocation(),
                F("with pin"), _powerPin2);
+        // Set the pin mode, just in case
+        pinMode(_powerPin2, OUTPUT);
         digitalWrite(_powerPin2, HIGH);
     }
     if (_powerPin < 0 && _powerPin2 < 0) {
@@ -169,7 +176,7 @@ void YosemitechParent::powerDown(void) {
     if (_powerPin >= 0) {
         MS_DBG(F("Turning off power to"), getSensorNameAndLocation(),
                F("with pin"), _powerPin);
-        digitalWrite(_powerPin, LOW);
+        _powerPinHandle.write(LOW);
         // Unset the power-on time
         _millisPowerOn = 0;
         // Unset the activation time
@@ -0,0 +1,67 @@
+/**
+ * @file MockSensor.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the MockSensor class.
+ */
+
+#include "MockSensor.h"
+#include "HostClock.h"
+
+
+MockSensor::MockSensor(const char* sensorName, uint32_t warmUpTime_ms,
+                       uint32_t stabilizationTime_ms,
+                       uint32_t measurementTime_ms, int8_t powerPin,
+                       uint8_t measurementsToAverage, float current_mA,
+                       float failureRate, uint32_t seed)
+    : Sensor(sensorName, 1, warmUpTime_ms, stabilizationTime_ms,
+             measurementTime_ms, powerPin, -1, measurementsToAverage) {
+    _current_mA       = current_mA;
+    _failureRate      = failureRate;
+    _randomState      = seed ? seed : 1;
+    _measurementCount = 0;
+    _failureCount     = 0;
+}
+MockSensor::~MockSensor() {}
+
+
+String MockSensor::getSensorLocation(void) {
+    String sensorLocation = F("Pin");
+    sensorLocation += String(_powerPin);
+    return sensorLocation;
+}
+
+
+bool MockSensor::addSingleMeasurementResult(void) {
+    bool success = false;
+
+    // Check a measurement was *successfully* started (status bit 6 set)
+    if (bitRead(_sensorStatus, 6)) {
+        _measurementCount++;
+        // A small xorshift generator; good enough to spread the failures
+        _randomState ^= _randomState << 13;
+        _randomState ^= _randomState >> 17;
+        _randomState ^= _randomState << 5;
+        float draw = static_cast<float>(_randomState % 10000) / 10000;
+        if (draw < _failureRate) {
+            _failureCount++;
+        } else {
+            verifyAndAddMeasurementResult(0, static_cast<float>(millis()));
+            success = true;
+        }
+    }
+
+    // Unset the time stamp for the beginning of this measurement
+    _millisMeasurementRequested = 0;
+    // Unset the status bits for a measurement request (bits 5 & 6)
+    _sensorStatus &= 0b10011111;
+
+    return success;
+}
+
+
+uint32_t MockSensor::getPoweredTime(uint32_t elapsed_ms) {
+    if (_powerPin < 0) return elapsed_ms;
+    return hostPinHighTime(_powerPin);
+}
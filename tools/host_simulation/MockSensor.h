@@ -0,0 +1,105 @@
+/**
+ * @file MockSensor.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the MockSensor subclass used by the host simulation.
+ *
+ * A mock sensor has the timing of a real sensor, but it takes no time to talk
+ * to and reports a made-up value.  A fraction of its measurements can be made
+ * to fail.  The failures come from a seeded pseudo-random sequence so every
+ * run of the same configuration is identical.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_SIMULATION_MOCKSENSOR_H_
+#define TOOLS_HOST_SIMULATION_MOCKSENSOR_H_
+
+#include "SensorBase.h"
+
+/**
+ * @brief A sensor with configurable timing and failure rate that only exists
+ * in the host simulation.
+ */
+class MockSensor : public Sensor {
+ public:
+    /**
+     * @brief Construct a new MockSensor object.
+     *
+     * @param sensorName The name of the sensor; the string must outlive the
+     * sensor.
+     * @param warmUpTime_ms The time needed from the when a sensor has power
+     * until it's ready to talk.
+     * @param stabilizationTime_ms The time needed from the when a sensor is
+     * activated until the readings are stable.
+     * @param measurementTime_ms The time needed from the when a sensor is told
+     * to take a single reading until that reading is expected to be complete.
+     * @param powerPin The simulated pin that switches power to the sensor; use
+     * -1 for a sensor that is always powered.
+     * @param measurementsToAverage The number of measurements to average.
+     * @param current_mA The current drawn by the sensor while it has power.
+     * @param failureRate The fraction of measurements, from 0 to 1, that
+     * return no value.
+     * @param seed The seed for the failure sequence.
+     */
+    MockSensor(const char* sensorName, uint32_t warmUpTime_ms,
+               uint32_t stabilizationTime_ms, uint32_t measurementTime_ms,
+               int8_t powerPin, uint8_t measurementsToAverage,
+               float current_mA, float failureRate, uint32_t seed);
+    /**
+     * @brief Destroy the MockSensor object
+     */
+    ~MockSensor();
+
+    /**
+     * @copydoc Sensor::getSensorLocation()
+     */
+    String getSensorLocation(void) override;
+
+    /**
+     * @copydoc Sensor::addSingleMeasurementResult()
+     */
+    bool addSingleMeasurementResult(void) override;
+
+    /**
+     * @brief Get the time the sensor has had power.
+     *
+     * @param elapsed_ms The total simulated time; a sensor without a power
+     * pin is powered the whole time.
+     * @return The powered time in milliseconds.
+     */
+    uint32_t getPoweredTime(uint32_t elapsed_ms);
+    /**
+     * @brief Get the current drawn by the sensor while it has power.
+     *
+     * @return The current in milliamps.
+     */
+    float getCurrent(void) {
+        return _current_mA;
+    }
+    /**
+     * @brief Get the number of measurements the sensor has been asked for.
+     *
+     * @return The number of measurements.
+     */
+    uint32_t getMeasurementCount(void) {
+        return _measurementCount;
+    }
+    /**
+     * @brief Get the number of measurements that failed.
+     *
+     * @return The number of failed measurements.
+     */
+    uint32_t getFailureCount(void) {
+        return _failureCount;
+    }
+
+ private:
+    float    _current_mA;
+    float    _failureRate;
+    uint32_t _randomState;
+    uint32_t _measurementCount;
+    uint32_t _failureCount;
+};
+
+#endif  // TOOLS_HOST_SIMULATION_MOCKSENSOR_H_
@@ -0,0 +1,209 @@
+/**
+ * @file host_simulation.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Runs a station configuration through VariableArray::completeUpdate()
+ * on a virtual clock and reports how long the logger and each sensor were
+ * awake and an estimate of the energy used.
+ *
+ * See ReadMe.md in this folder for the configuration file format.
+ */
+
+#include "HostClock.h"
+#include "MockSensor.h"
+#include "VariableArray.h"
+
+
+/**
+ * @brief The settings of the simulated logger.
+ */
+struct LoggerSettings {
+    uint32_t interval_min = 5;
+    uint32_t updates      = 288;
+    float    awake_mA     = 20;
+    float    sleep_mA     = 0.2;
+    uint32_t maxAwake_ms  = 0;
+};
+
+static MockSensor* sensors[MAX_NUMBER_SENSORS];
+static Variable*   variables[MAX_NUMBER_SENSORS];
+static uint8_t     sensorCount = 0;
+
+
+// Reads a bus description like "i2c:1" into a bus type and id
+static bool parseBus(const char* text, sensorBusType* type, uint32_t* id) {
+    const char* colon = strchr(text, ':');
+    size_t      len   = colon ? static_cast<size_t>(colon - text)
+                              : strlen(text);
+    *id               = colon ? strtoul(colon + 1, NULL, 10) : 0;
+    if (len == 4 && strncmp(text, "none", len) == 0) {
+        *type = SENSOR_BUS_NONE;
+    } else if (len == 5 && strncmp(text, "sdi12", len) == 0) {
+        *type = SENSOR_BUS_SDI12;
+    } else if (len == 6 && strncmp(text, "modbus", len) == 0) {
+        *type = SENSOR_BUS_MODBUS;
+    } else if (len == 6 && strncmp(text, "serial", len) == 0) {
+        *type = SENSOR_BUS_SERIAL;
+    } else if (len == 3 && strncmp(text, "i2c", len) == 0) {
+        *type = SENSOR_BUS_I2C;
+    } else if (len == 7 && strncmp(text, "onewire", len) == 0) {
+        *type = SENSOR_BUS_ONEWIRE;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+
+// Reads the configuration file; returns false on any error
+static bool readConfiguration(FILE* file, LoggerSettings* settings) {
+    char     line[256];
+    uint16_t lineNumber = 0;
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+
+        char keyword[16];
+        if (sscanf(line, "%15s", keyword) != 1) continue;
+
+        if (strcmp(keyword, "logger") == 0) {
+            int fields = sscanf(line, "%*s %u %u %f %f %u",
+                                &settings->interval_min, &settings->updates,
+                                &settings->awake_mA, &settings->sleep_mA,
+                                &settings->maxAwake_ms);
+            if (fields < 4 || settings->interval_min == 0) {
+                fprintf(stderr, "Line %u: bad logger settings\n", lineNumber);
+                return false;
+            }
+        } else if (strcmp(keyword, "sensor") == 0) {
+            char     name[32];
+            char     bus[32]  = "none";
+            uint32_t warmUp   = 0;
+            uint32_t stab     = 0;
+            uint32_t meas     = 0;
+            int      powerPin = -1;
+            unsigned average  = 1;
+            float    current  = 0;
+            float    failure  = 0;
+            unsigned interval = 1;
+            int      fields   = sscanf(
+                line, "%*s %31s %u %u %u %d %u %f %f %u %31s", name, &warmUp,
+                &stab, &meas, &powerPin, &average, &current, &failure,
+                &interval, bus);
+            sensorBusType busType;
+            uint32_t      busId;
+            if (fields < 8 || powerPin >= HOST_NUM_PINS || average == 0 ||
+                interval == 0 || !parseBus(bus, &busType, &busId)) {
+                fprintf(stderr, "Line %u: bad sensor settings\n", lineNumber);
+                return false;
+            }
+            if (sensorCount >= MAX_NUMBER_SENSORS) {
+                fprintf(stderr, "Line %u: more than %u sensors\n", lineNumber,
+                        MAX_NUMBER_SENSORS);
+                return false;
+            }
+
+            // The sensor and variable keep the pointers to their names
+            const char* savedName = strdup(name);
+            MockSensor* sensor = new MockSensor(
+                savedName, warmUp, stab, meas, powerPin, average, current,
+                failure, sensorCount + 1);
+            sensor->setSamplingInterval(interval);
+            sensor->setBus(busType, busId);
+            sensors[sensorCount]   = sensor;
+            variables[sensorCount] = new Variable(sensor, 0, 1, savedName,
+                                                  "unknown", savedName, "");
+            sensorCount++;
+        } else {
+            fprintf(stderr, "Line %u: unknown keyword '%s'\n", lineNumber,
+                    keyword);
+            return false;
+        }
+    }
+    if (sensorCount == 0) {
+        fprintf(stderr, "No sensors in the configuration\n");
+        return false;
+    }
+    return true;
+}
+
+
+// Converts a current and a time into charge
+static float milliampHours(float current_mA, uint32_t time_ms) {
+    return current_mA * time_ms / 3600000.0f;
+}
+
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <configuration file>\n", argv[0]);
+        return 2;
+    }
+    FILE* file = fopen(argv[1], "r");
+    if (!file) {
+        fprintf(stderr, "Unable to open %s\n", argv[1]);
+        return 2;
+    }
+    LoggerSettings settings;
+    bool           configured = readConfiguration(file, &settings);
+    fclose(file);
+    if (!configured) return 2;
+
+    VariableArray array(sensorCount, variables);
+    array.setupSensors();
+
+    uint32_t interval_ms   = settings.interval_min * 60000UL;
+    uint32_t start_ms      = millis();
+    uint32_t totalAwake    = 0;
+    uint32_t longestAwake  = 0;
+    uint16_t failedUpdates = 0;
+    for (uint32_t cycle = 0; cycle < settings.updates; cycle++) {
+        // Wake at the start of each logging interval, or right away if the
+        // last update ran into this one
+        hostSetMillis(start_ms + cycle * interval_ms);
+        uint32_t wake_ms = millis();
+        if (!array.completeUpdate(cycle)) failedUpdates++;
+        uint32_t awake_ms = millis() - wake_ms;
+        totalAwake += awake_ms;
+        if (awake_ms > longestAwake) longestAwake = awake_ms;
+    }
+    hostSetMillis(start_ms + settings.updates * interval_ms);
+    uint32_t elapsed_ms = millis() - start_ms;
+
+    printf("Simulated %u updates of %u sensors over %.1f hours\n",
+           settings.updates, sensorCount, elapsed_ms / 3600000.0);
+    printf("Predicted time of the last update: %u ms\n",
+           array.getPredictedUpdateTime());
+    printf("Logger awake time: %u ms total, %.1f ms mean, %u ms longest\n",
+           totalAwake, static_cast<double>(totalAwake) / settings.updates,
+           longestAwake);
+    printf("Updates with a failure: %u\n\n", failedUpdates);
+
+    float totalCharge = milliampHours(settings.awake_mA, totalAwake) +
+        milliampHours(settings.sleep_mA, elapsed_ms - totalAwake);
+    printf("sensor,pin,poweredMs,dutyCyclePct,measurements,failures,mAh\n");
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        uint32_t powered = sensors[i]->getPoweredTime(elapsed_ms);
+        float    charge  = milliampHours(sensors[i]->getCurrent(), powered);
+        totalCharge += charge;
+        printf("%s,%d,%u,%.3f,%u,%u,%.4f\n",
+               sensors[i]->getSensorName().c_str(), sensors[i]->getPowerPin(),
+               powered, 100.0 * powered / elapsed_ms,
+               sensors[i]->getMeasurementCount(),
+               sensors[i]->getFailureCount(), charge);
+    }
+    printf("\nLogger charge: %.4f mAh awake, %.4f mAh asleep\n",
+           milliampHours(settings.awake_mA, totalAwake),
+           milliampHours(settings.sleep_mA, elapsed_ms - totalAwake));
+    printf("Total charge: %.4f mAh, mean current %.4f mA\n", totalCharge,
+           totalCharge * 3600000.0 / elapsed_ms);
+
+    if (settings.maxAwake_ms > 0 && longestAwake > settings.maxAwake_ms) {
+        printf("\nFAIL: the longest update (%u ms) is over the %u ms limit\n",
+               longestAwake, settings.maxAwake_ms);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file Arduino.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the virtual clock and simulated pins of the host shim.
+ */
+
+#include "HostClock.h"
+
+HostSerial        Serial;
+volatile HostPort host_ports[HOST_NUM_PINS / 8];
+uint8_t           SREG = 0;
+
+static uint32_t host_millis    = 1;
+static uint16_t host_spinCount = 0;
+static uint32_t host_pinHighSince[HOST_NUM_PINS];
+static uint32_t host_pinHighTotal[HOST_NUM_PINS];
+
+
+void hostSetMillis(uint32_t now_ms) {
+    if (static_cast<int32_t>(now_ms - host_millis) > 0) {
+        host_millis    = now_ms;
+        host_spinCount = 0;
+    }
+}
+
+
+uint32_t hostPinHighTime(uint8_t pin) {
+    if (pin >= HOST_NUM_PINS) return 0;
+    uint32_t total = host_pinHighTotal[pin];
+    if (digitalRead(pin) == HIGH) total += host_millis - host_pinHighSince[pin];
+    return total;
+}
+
+
+uint32_t millis(void) {
+    if (++host_spinCount > HOST_SPIN_LIMIT) hostSetMillis(host_millis + 1);
+    return host_millis;
+}
+uint32_t micros(void) {
+    return millis() * 1000;
+}
+void delay(uint32_t ms) {
+    hostSetMillis(host_millis + ms);
+}
+void delayMicroseconds(uint32_t) {}
+// Anything waiting in a yield() loop is waiting for time to pass
+void yield(void) {
+    hostSetMillis(host_millis + 1);
+}
+
+
+void pinMode(uint8_t, uint8_t) {}
+// Bits that go high start their high time; bits that go low add to it
+void HostPort::operator|=(int mask) volatile {
+    uint8_t rising = mask & ~bits;
+    uint8_t port   = this - host_ports;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (bitRead(rising, bit)) {
+            host_pinHighSince[port * 8 + bit] = host_millis;
+        }
+    }
+    bits |= mask;
+}
+void HostPort::operator&=(int mask) volatile {
+    uint8_t falling = bits & ~mask;
+    uint8_t port    = this - host_ports;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (bitRead(falling, bit)) {
+            host_pinHighTotal[port * 8 + bit] += host_millis -
+                host_pinHighSince[port * 8 + bit];
+        }
+    }
+    bits &= mask;
+}
+
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= HOST_NUM_PINS) return;
+    if (value == HIGH) {
+        host_ports[pin / 8] |= digitalPinToBitMask(pin);
+    } else {
+        host_ports[pin / 8] &= ~digitalPinToBitMask(pin);
+    }
+}
+int digitalRead(uint8_t pin) {
+    if (pin >= HOST_NUM_PINS) return LOW;
+    return bitRead(host_ports[pin / 8].bits, pin % 8);
+}
+int analogRead(uint8_t) {
+    return 0;
+}
+
+
+char* dtostrf(double val, signed char width, unsigned char prec, char* sout) {
+    sprintf(sout, "%*.*f", width, prec, val);
+    return sout;
+}
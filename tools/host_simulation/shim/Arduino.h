@@ -0,0 +1,349 @@
+/**
+ * @file Arduino.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A minimal stand-in for the Arduino core so the sensor and variable
+ * classes can be compiled and run on a desktop computer.
+ *
+ * Only the parts of the core used by SensorBase, VariableBase, and
+ * VariableArray are provided.  Time comes from a virtual clock that only moves
+ * when the simulation moves it, when delay() is called, or when the library
+ * waits in a yield() loop.  There are no interrupts and no real pins; the
+ * "pins" are bits in an array and the simulation keeps track of how long each
+ * one was high, whether it was written with digitalWrite() or through its
+ * port register.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_SIMULATION_SHIM_ARDUINO_H_
+#define TOOLS_HOST_SIMULATION_SHIM_ARDUINO_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) \
+    ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+template <class A, class B>
+auto max(A a, B b) -> decltype(a + b) {
+    return a > b ? a : b;
+}
+template <class A, class B>
+auto min(A a, B b) -> decltype(a + b) {
+    return a < b ? a : b;
+}
+
+// Flash strings are ordinary strings on the host
+class __FlashStringHelper;
+#define F(string_literal) \
+    (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+/**
+ * @brief The number of simulated digital pins.
+ */
+#define HOST_NUM_PINS 128
+
+// The virtual clock
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+void     yield(void);
+
+/**
+ * @brief A simulated 8-pin port register.
+ *
+ * Setting and clearing bits goes through the same high-time bookkeeping as
+ * digitalWrite(), so pins written directly through their port register are
+ * tracked too.
+ */
+class HostPort {
+ public:
+    operator uint8_t() const volatile {
+        return bits;
+    }
+    void operator|=(int mask) volatile;
+    void operator&=(int mask) volatile;
+
+    uint8_t bits;
+};
+
+// The simulated pins
+extern volatile HostPort host_ports[HOST_NUM_PINS / 8];
+void                     pinMode(uint8_t pin, uint8_t mode);
+void                     digitalWrite(uint8_t pin, uint8_t value);
+int                      digitalRead(uint8_t pin);
+int                      analogRead(uint8_t pin);
+#define digitalPinToBitMask(P) (static_cast<uint8_t>(1 << ((P) % 8)))
+// Ports are numbered from 1, as on AVR boards, so 0 is never a real port
+#define NOT_A_PIN 0
+#define NOT_A_PORT 0
+#define digitalPinToPort(P) ((P) / 8 + 1)
+#define portInputRegister(P) (&host_ports[(P)-1])
+#define portOutputRegister(P) (&host_ports[(P)-1])
+
+#define noInterrupts()
+#define interrupts()
+// The AVR status register; there are no interrupts here to turn off
+extern uint8_t SREG;
+#define cli()
+
+class String;
+
+class Print {
+ public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) {
+        return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+    }
+    size_t write(const char* buffer, size_t size) {
+        return write(reinterpret_cast<const uint8_t*>(buffer), size);
+    }
+    virtual void flush() {}
+
+    size_t print(const char* str) {
+        return write(str);
+    }
+    size_t print(const __FlashStringHelper* str) {
+        return write(reinterpret_cast<const char*>(str));
+    }
+    size_t print(char c) {
+        return write(static_cast<uint8_t>(c));
+    }
+    size_t print(const String& str);
+    size_t print(int n, int base = DEC) {
+        return printFormatted(base == HEX ? "%x" : "%d", n);
+    }
+    size_t print(unsigned int n, int base = DEC) {
+        return printFormatted(base == HEX ? "%x" : "%u", n);
+    }
+    size_t print(long n, int base = DEC) {
+        return printFormatted(base == HEX ? "%lx" : "%ld", n);
+    }
+    size_t print(unsigned long n, int base = DEC) {
+        return printFormatted(base == HEX ? "%lx" : "%lu", n);
+    }
+    size_t print(double n, int digits = 2) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+        return print(buffer);
+    }
+
+    size_t println(void) {
+        return print("\r\n");
+    }
+    template <typename T>
+    size_t println(T value) {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(T value, int format) {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+ private:
+    template <typename T>
+    size_t printFormatted(const char* format, T n) {
+        char buffer[34];
+        snprintf(buffer, sizeof(buffer), format, n);
+        return print(buffer);
+    }
+};
+
+class Stream : public Print {
+ public:
+    virtual int available() {
+        return 0;
+    }
+    virtual int read() {
+        return -1;
+    }
+    virtual int peek() {
+        return -1;
+    }
+    void setTimeout(unsigned long) {}
+};
+
+class String {
+ public:
+    String() {}
+    String(const char* cstr) {  // NOLINT(runtime/explicit)
+        if (cstr) _buffer = cstr;
+    }
+    String(const __FlashStringHelper* str) {  // NOLINT(runtime/explicit)
+        if (str) _buffer = reinterpret_cast<const char*>(str);
+    }
+    explicit String(char c) : _buffer(1, c) {}
+    explicit String(int value, unsigned char base = 10) {
+        format(base == 16 ? "%x" : "%d", value);
+    }
+    explicit String(unsigned int value, unsigned char base = 10) {
+        format(base == 16 ? "%x" : "%u", value);
+    }
+    explicit String(long value, unsigned char base = 10) {
+        format(base == 16 ? "%lx" : "%ld", value);
+    }
+    explicit String(unsigned long value, unsigned char base = 10) {
+        format(base == 16 ? "%lx" : "%lu", value);
+    }
+    explicit String(float value, unsigned char decimalPlaces = 2) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces,
+                 static_cast<double>(value));
+        _buffer = buffer;
+    }
+    explicit String(double value, unsigned char decimalPlaces = 2) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+        _buffer = buffer;
+    }
+
+    unsigned int length(void) const {
+        return _buffer.size();
+    }
+    const char* c_str(void) const {
+        return _buffer.c_str();
+    }
+    void toCharArray(char* buf, unsigned int bufsize) const {
+        if (!bufsize) return;
+        strncpy(buf, _buffer.c_str(), bufsize - 1);
+        buf[bufsize - 1] = '\0';
+    }
+    void reserve(unsigned int size) {
+        _buffer.reserve(size);
+    }
+
+    String& operator+=(const String& rhs) {
+        _buffer += rhs._buffer;
+        return *this;
+    }
+    String& operator+=(const char* rhs) {
+        _buffer += rhs;
+        return *this;
+    }
+    String& operator+=(char rhs) {
+        _buffer += rhs;
+        return *this;
+    }
+    String& operator+=(int rhs) {
+        return *this += String(rhs);
+    }
+    String& operator+=(const __FlashStringHelper* rhs) {
+        _buffer += reinterpret_cast<const char*>(rhs);
+        return *this;
+    }
+    bool operator==(const String& rhs) const {
+        return _buffer == rhs._buffer;
+    }
+    bool operator==(const char* rhs) const {
+        return _buffer == rhs;
+    }
+    bool operator!=(const String& rhs) const {
+        return _buffer != rhs._buffer;
+    }
+    bool operator!=(const char* rhs) const {
+        return _buffer != rhs;
+    }
+    char operator[](unsigned int index) const {
+        return _buffer[index];
+    }
+    char charAt(unsigned int index) const {
+        return _buffer[index];
+    }
+    int indexOf(char c) const {
+        size_t found = _buffer.find(c);
+        return found == std::string::npos ? -1 : static_cast<int>(found);
+    }
+    String substring(unsigned int beginIndex) const {
+        return String(_buffer.substr(beginIndex).c_str());
+    }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const {
+        return String(
+            _buffer.substr(beginIndex, endIndex - beginIndex).c_str());
+    }
+    long toInt(void) const {
+        return atol(_buffer.c_str());
+    }
+    float toFloat(void) const {
+        return atof(_buffer.c_str());
+    }
+
+ private:
+    template <typename T>
+    void format(const char* fmt, T value) {
+        char buffer[34];
+        snprintf(buffer, sizeof(buffer), fmt, value);
+        _buffer = buffer;
+    }
+
+    std::string _buffer;
+};
+
+inline String operator+(const String& lhs, const String& rhs) {
+    String result = lhs;
+    return result += rhs;
+}
+inline String operator+(const String& lhs, const char* rhs) {
+    String result = lhs;
+    return result += rhs;
+}
+inline String operator+(const String& lhs, char rhs) {
+    String result = lhs;
+    return result += rhs;
+}
+inline size_t Print::print(const String& str) {
+    return write(str.c_str());
+}
+
+/**
+ * @brief The "serial port" of the host; it writes to standard out.
+ */
+class HostSerial : public Stream {
+ public:
+    size_t write(uint8_t c) override {
+        putchar(c);
+        return 1;
+    }
+    using Print::write;
+    void begin(unsigned long) {}
+    operator bool() {
+        return true;
+    }
+};
+extern HostSerial Serial;
+
+char* dtostrf(double val, signed char width, unsigned char prec, char* sout);
+
+#endif  // TOOLS_HOST_SIMULATION_SHIM_ARDUINO_H_
@@ -0,0 +1,42 @@
+/**
+ * @file HostClock.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Controls for the virtual clock and simulated pins of the host shim.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_SIMULATION_SHIM_HOSTCLOCK_H_
+#define TOOLS_HOST_SIMULATION_SHIM_HOSTCLOCK_H_
+
+#include "Arduino.h"
+
+/**
+ * @brief The number of times millis() may be read without the clock moving
+ * before the shim assumes the caller is spinning and moves it forward 1 ms.
+ *
+ * This keeps any polling loop in the library from hanging the simulation
+ * while leaving the clock untouched by ordinary reads.
+ */
+#define HOST_SPIN_LIMIT 1000
+
+/**
+ * @brief Set the virtual clock to a time in milliseconds.
+ *
+ * The clock never runs backwards; earlier times are ignored.
+ *
+ * @param now_ms The new time of the virtual clock.
+ */
+void hostSetMillis(uint32_t now_ms);
+
+/**
+ * @brief Get the total time a simulated pin has been high, including any
+ * time up to now if it is currently high.
+ *
+ * @param pin The pin number.
+ * @return The total high time in milliseconds.
+ */
+uint32_t hostPinHighTime(uint8_t pin);
+
+#endif  // TOOLS_HOST_SIMULATION_SHIM_HOSTCLOCK_H_
@@ -0,0 +1,16 @@
+/**
+ * @file pins_arduino.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Empty stand-in for the board pin definitions; the simulated pins are
+ * declared in Arduino.h.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_SIMULATION_SHIM_PINS_ARDUINO_H_
+#define TOOLS_HOST_SIMULATION_SHIM_PINS_ARDUINO_H_
+
+#include "Arduino.h"
+
+#endif  // TOOLS_HOST_SIMULATION_SHIM_PINS_ARDUINO_H_
@@ -0,0 +1,60 @@
+/**
+ * @file value_formatter_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Checks ValueFormatter::formatFloat() against `String(value, n)` for
+ * random values.
+ *
+ * Values with no decimal places are checked against the value cut off toward
+ * zero instead, as formatFloat() writes them.  Exact ties, which `String`
+ * rounds to even and formatFloat() rounds up, are skipped.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Arduino.h>
+#include "ValueFormatter.h"
+
+static const uint32_t testCount = 200000;
+
+// True if the value is exactly half way between two values of the last place
+static bool isExactTie(float value, uint8_t decimalPlaces) {
+    double scaled = fabs(static_cast<double>(value)) * pow(10, decimalPlaces);
+    return scaled - floor(scaled) == 0.5;
+}
+
+// A random float of up to about 10^7 in size, with either sign
+static float randomValue(void) {
+    double magnitude = pow(10, (rand() % 1400) / 200.0 - 2);
+    double value     = magnitude * rand() / RAND_MAX;
+    return static_cast<float>(rand() % 2 ? value : -value);
+}
+
+int main(void) {
+    srand(42);
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < testCount; i++) {
+        float   value         = randomValue();
+        uint8_t decimalPlaces = i % 5;
+        if (isExactTie(value, decimalPlaces)) continue;
+
+        String expected = decimalPlaces == 0
+            ? String(static_cast<long>(value))
+            : String(value, decimalPlaces);
+        char formatted[MS_MAX_FORMATTED_FLOAT_LENGTH + 1];
+        ValueFormatter::formatFloat(formatted, sizeof(formatted), value,
+                                    decimalPlaces);
+        if (expected != formatted) {
+            if (mismatches < 20) {
+                printf("%.9g at %u places: expected %s, got %s\n", value,
+                       decimalPlaces, expected.c_str(), formatted);
+            }
+            mismatches++;
+        }
+    }
+    printf("%u mismatches in %u values\n", mismatches, testCount);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file warm_up_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Checks that an adaptive warm-up time is learned again after every
+ * power cycle, both for sensors using Sensor::powerUp() and for sensors that
+ * switch their own power, as the Modbus sensors do.
+ */
+
+#include <stdio.h>
+
+#include "HostClock.h"
+#include "MockSensor.h"
+
+/**
+ * @brief A sensor that turns its own power on, like YosemitechParent and
+ * KellerParent, instead of using Sensor::powerUp().
+ */
+class SelfPoweredSensor : public MockSensor {
+ public:
+    SelfPoweredSensor(const char* sensorName, uint32_t warmUpTime_ms,
+                      int8_t powerPin)
+        : MockSensor(sensorName, warmUpTime_ms, 0, 100, powerPin, 1, 1, 0,
+                     1) {}
+
+    void powerUp(void) override {
+        _powerPinHandle.write(HIGH);
+        markPoweredOn();
+        _sensorStatus |= 0b00000110;
+    }
+};
+
+static uint32_t now_ms = 1000;
+
+// Power the sensor, let it answer after the given time and number of tries,
+// then power it down; returns the learned warm-up time
+static uint32_t powerCycle(Sensor* sensor, uint32_t answer_ms,
+                           uint8_t attempts) {
+    sensor->powerUp();
+    now_ms += answer_ms;
+    hostSetMillis(now_ms);
+    sensor->recordReadiness(attempts);
+    sensor->powerDown();
+    now_ms += 60000L;
+    hostSetMillis(now_ms);
+    return sensor->getLearnedWarmUpTime();
+}
+
+// Two power cycles that each answer only after a few retries must each set
+// the learned time
+static uint8_t checkSensor(Sensor* sensor) {
+    hostSetMillis(now_ms);
+    sensor->setup();
+    sensor->setAdaptiveWarmUp(true);
+    uint32_t first  = powerCycle(sensor, 800, 3);
+    uint32_t second = powerCycle(sensor, 600, 2);
+    bool     passed = first == 800 && second == 600;
+    printf("%s: learned %u ms, then %u ms - %s\n",
+           sensor->getSensorName().c_str(), first, second,
+           passed ? "ok" : "FAILED");
+    return passed ? 0 : 1;
+}
+
+int main(void) {
+    MockSensor        baseSensor("BasePowered", 1000, 0, 100, 2, 1, 1, 0, 1);
+    SelfPoweredSensor selfSensor("SelfPowered", 1000, 3);
+
+    uint8_t failures = checkSensor(&baseSensor) + checkSensor(&selfSensor);
+    return failures == 0 ? 0 : 1;
+}